@@ -13732,6 +13732,7 @@ void zone_sort_activity_actor::stage_init( player_activity &, Character &you )
     mgr.cache_avatar_location();
     coord_set.clear();
     unreachable_sources.clear();
+    planned_map_origin.reset();
     const faction_id fac = you.get_faction_id();
     const bool skip_personal = !you.is_avatar() && mgr.has_personal_zones();
     for( const tripoint_abs_ms &p :
@@ -14025,6 +14026,16 @@ void zone_sort_activity_actor::return_items_to_source( Character &you,
     dropoff_coords.clear();
 }
 
+void zone_sort_activity_actor::plan_sources( Character &you )
+{
+    const tripoint_abs_sm map_origin = get_map().get_abs_sub();
+    if( planned_map_origin == map_origin ) {
+        return;
+    }
+    sources_by_dest = zone_sorting::plan_sort_pass( you, coord_set, other_activity_items );
+    planned_map_origin = map_origin;
+}
+
 void zone_sort_activity_actor::stage_do( player_activity &act, Character &you )
 {
     map &here = get_map();
@@ -14608,12 +14619,24 @@ void zone_sort_activity_actor::stage_do( player_activity &act, Character &you )
                 batch_cart_vp = here.veh_at( cart_pos ).cargo();
             }
 
-            // Build distance-sorted candidates using A* route distances.
-            // Pre-sort by Chebyshev (lower bound on route distance) and use it
-            // as a cheap filter before expensive A* calls.
+            // Only sources planned to hold items bound for the zone types of
+            // this load can be worth a detour.
+            plan_sources( you );
+            std::unordered_set<tripoint_abs_ms> planned_candidates;
+            for( const item_location &loc : picked_up_stuff ) {
+                const zone_type_id zt = mgr.get_near_zone_type_for_item( *loc, abspos,
+                                        MAX_VIEW_DISTANCE, fac_id );
+                const auto planned = sources_by_dest.find( zt );
+                if( planned != sources_by_dest.end() ) {
+                    planned_candidates.insert( planned->second.begin(), planned->second.end() );
+                }
+            }
+
+            // Pre-sort candidates by Chebyshev distance, a lower bound on route
+            // distance, and drop those that can't be closer than the destination.
             std::vector<std::pair<int, tripoint_abs_ms>> batch_presorted;
-            for( const tripoint_abs_ms &candidate : coord_set ) {
-                if( candidate == src ) {
+            for( const tripoint_abs_ms &candidate : planned_candidates ) {
+                if( candidate == src || !coord_set.count( candidate ) ) {
                     continue;
                 }
                 if( unreachable_sources.count( candidate ) ) {
@@ -14641,35 +14664,10 @@ void zone_sort_activity_actor::stage_do( player_activity &act, Character &you )
                 return a.first < b.first;
             } );
 
-            // Compute actual A* route distances for survivors.
-            std::vector<std::pair<int, tripoint_abs_ms>> batch_candidates;
-            for( const auto &[cheb, candidate] : batch_presorted ) {
-                if( cheb <= 1 ) {
-                    // Adjacent -- no pathfinding needed.
-                    batch_candidates.emplace_back( 0, candidate );
-                    continue;
-                }
-                const tripoint_bub_ms cand_bub = here.get_bub( candidate );
-                const int rdist = zone_sorting::route_length( you, cand_bub );
-                if( rdist == INT_MAX ) {
-                    unreachable_sources.emplace( candidate );
-                    continue;
-                }
-                if( rdist >= dest_dist ) {
-                    // Closer by Chebyshev but not by actual route distance.
-                    continue;
-                }
-                batch_candidates.emplace_back( rdist, candidate );
-            }
-            std::sort( batch_candidates.begin(), batch_candidates.end(),
-                       []( const std::pair<int, tripoint_abs_ms> &a,
-            const std::pair<int, tripoint_abs_ms> &b ) {
-                return a.first < b.first;
-            } );
-
-            bool should_batch = false;
-            tripoint_abs_ms batch_target;
-            for( const auto &[cand_dist, candidate] : batch_candidates ) {
+            // A candidate is only worth a detour when it holds an item bound for
+            // one of the current destinations that still fits, so check its items
+            // before paying for a route to it.
+            const auto has_batchable_item = [&]( const tripoint_abs_ms & candidate ) {
                 const tripoint_bub_ms cand_bub = here.get_bub( candidate );
                 const bool cand_has_terrain_unsorted =
                     mgr.has_terrain( zone_type_LOOT_UNSORTED, candidate, fac_id );
@@ -14729,14 +14727,36 @@ void zone_sort_activity_actor::stage_do( player_activity &act, Character &you )
                         }
                     }
                     if( fits ) {
-                        should_batch = true;
-                        batch_target = candidate;
-                        break;
+                        return true;
                     }
                 }
-                if( should_batch ) {
+                return false;
+            };
+
+            // Pick the closest batchable candidate by route distance. Candidates
+            // come in Chebyshev order, so stop once none can beat the best route.
+            bool should_batch = false;
+            tripoint_abs_ms batch_target;
+            int batch_dist = dest_dist;
+            for( const auto &[cheb, candidate] : batch_presorted ) {
+                if( cheb >= batch_dist ) {
                     break;
                 }
+                if( !has_batchable_item( candidate ) ) {
+                    continue;
+                }
+                // Adjacent -- no pathfinding needed.
+                const int rdist = cheb <= 1 ? 0 :
+                                  zone_sorting::route_length( you, here.get_bub( candidate ) );
+                if( rdist == INT_MAX ) {
+                    unreachable_sources.emplace( candidate );
+                    continue;
+                }
+                if( rdist < batch_dist ) {
+                    should_batch = true;
+                    batch_target = candidate;
+                    batch_dist = rdist;
+                }
             }
 
             if( should_batch ) {
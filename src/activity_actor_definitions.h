@@ -4209,10 +4209,19 @@ class zone_sort_activity_actor : public zone_activity_actor
         // Computed once when dropoff_coords is first populated in stage_do,
         // persists across do_turn re-entries within the same source.
         std::optional<tripoint_bub_ms> drag_worst_tile; // NOLINT(cata-serialize)
+        // Sources of this pass keyed by the zone type their items are bound for.
+        // Batching only considers detours to sources planned for the current load.
+        // Not saved: rebuilt from coord_set when first needed and whenever the map shifts.
+        std::unordered_map<zone_type_id, std::unordered_set<tripoint_abs_ms>>
+        sources_by_dest; // NOLINT(cata-serialize)
+        // Map origin sources_by_dest was planned at, empty if it needs planning.
+        std::optional<tripoint_abs_sm> planned_map_origin; // NOLINT(cata-serialize)
 
         // Returns all picked up items to the source tile and clears sorting state.
         // Used when routing to a destination fails.
         void return_items_to_source( Character &you, const tripoint_bub_ms &src_bub );
+        // Builds sources_by_dest unless it is current.
+        void plan_sources( Character &you );
 };
 
 #endif // CATA_SRC_ACTIVITY_ACTOR_DEFINITIONS_H
@@ -972,6 +972,39 @@ bool sort_skip_item( Character &you, const item *it,
     return false;
 }
 
+sort_plan plan_sort_pass( Character &you, const std::unordered_set<tripoint_abs_ms> &sources,
+                          const std::vector<item_location> &other_activity_items )
+{
+    const map &here = get_map();
+    const zone_manager &mgr = zone_manager::get_manager();
+    const faction_id fac_id = _fac_id( you );
+    const tripoint_abs_ms abspos = you.pos_abs();
+    sort_plan plan;
+    for( const tripoint_abs_ms &src : sources ) {
+        const tripoint_bub_ms src_bub = here.get_bub( src );
+        if( !here.inbounds( src_bub ) ) {
+            continue;
+        }
+        const bool has_terrain_unsorted = mgr.has_terrain( zone_type_LOOT_UNSORTED, src, fac_id );
+        const bool has_vehicle_unsorted = mgr.has_vehicle( zone_type_LOOT_UNSORTED, src, fac_id );
+        const bool ignore_favorite = mgr.has( zone_type_LOOT_IGNORE_FAVORITES, src, fac_id );
+        for( const std::pair<item *, bool> &it : populate_items( src_bub ) ) {
+            if( it.second ? !has_vehicle_unsorted : !has_terrain_unsorted ) {
+                continue;
+            }
+            if( sort_skip_item( you, it.first, other_activity_items, ignore_favorite, src ) ) {
+                continue;
+            }
+            const zone_type_id zt_id = mgr.get_near_zone_type_for_item( *it.first, abspos,
+                                       MAX_VIEW_DISTANCE, fac_id );
+            if( zt_id != zone_type_id::NULL_ID() ) {
+                plan[zt_id].insert( src );
+            }
+        }
+    }
+    return plan;
+}
+
 unload_sort_options set_unload_options( Character &you, const tripoint_abs_ms &src,
                                         bool use_zone_type )
 {
@@ -1,5 +1,6 @@
 #include <memory>
 #include <optional>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -123,6 +124,13 @@ void move_item( Character &you, const std::optional<vpart_reference> &vpr_src,
                 const tripoint_bub_ms &src_bub, const std::unordered_set<tripoint_abs_ms> &dest_set,
                 item &it, int &num_processed );
 
+// Sources of a sorting pass keyed by the zone type their items are bound for.
+using sort_plan = std::unordered_map<zone_type_id, std::unordered_set<tripoint_abs_ms>>;
+// Scans the items of every in-bounds source once and records where they are going,
+// so picking batch detours doesn't need to look at sources holding nothing for them.
+sort_plan plan_sort_pass( Character &you, const std::unordered_set<tripoint_abs_ms> &sources,
+                          const std::vector<item_location> &other_activity_items );
+
 // Returns A* route length from the player to a tile adjacent to dest.
 // Uses grab-aware routing when the player is dragging a vehicle.
 // Returns INT_MAX if unreachable.
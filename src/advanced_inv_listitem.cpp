@@ -42,3 +42,19 @@ advanced_inv_listitem::advanced_inv_listitem( const std::vector<item_location> &
 {
     cata_assert( stacks >= 1 );
 }
+
+const localized_sort_key &advanced_inv_listitem::name_key() const
+{
+    if( !name_key_ ) {
+        name_key_.emplace( name );
+    }
+    return *name_key_;
+}
+
+const localized_sort_key &advanced_inv_listitem::name_without_prefix_key() const
+{
+    if( !name_without_prefix_key_ ) {
+        name_without_prefix_key_.emplace( name_without_prefix );
+    }
+    return *name_without_prefix_key_;
+}
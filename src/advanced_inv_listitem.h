@@ -2,10 +2,12 @@
 #ifndef CATA_SRC_ADVANCED_INV_LISTITEM_H
 #define CATA_SRC_ADVANCED_INV_LISTITEM_H
 
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "item_location.h"
+#include "localized_comparator.h"
 #include "type_id.h"
 #include "units.h"
 
@@ -85,5 +87,16 @@ class advanced_inv_listitem
          */
         advanced_inv_listitem( const std::vector<item_location> &list, int index,
                                aim_location area, bool from_vehicle );
+
+        /**
+         * Collation keys of @ref name and @ref name_without_prefix. They are only
+         * built once the list actually gets sorted by name.
+         */
+        const localized_sort_key &name_key() const;
+        const localized_sort_key &name_without_prefix_key() const;
+
+    private:
+        mutable std::optional<localized_sort_key> name_key_;
+        mutable std::optional<localized_sort_key> name_without_prefix_key_;
 };
 #endif // CATA_SRC_ADVANCED_INV_LISTITEM_H
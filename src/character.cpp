@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -396,57 +397,210 @@ queued_eocs::queued_eocs() = default;
 queued_eocs::queued_eocs( const queued_eocs &rhs )
 {
     list = rhs.list;
+    cursor = rhs.cursor;
     for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-        queue.emplace( it );
+        schedule( it );
     }
 }
 
 queued_eocs::queued_eocs( queued_eocs &&rhs ) noexcept
 {
-    queue.swap( rhs.queue );
     list.swap( rhs.list );
+    std::swap( cursor, rhs.cursor );
+    std::swap( scheduled, rhs.scheduled );
+    wheel.swap( rhs.wheel );
+    overflow.swap( rhs.overflow );
 }
 
 queued_eocs &queued_eocs::operator=( const queued_eocs &rhs )
 {
     list = rhs.list;
-    // Why doesn't std::priority_queue have a clear() function.
-    queue = {};
+    wheel = {};
+    overflow.clear();
+    cursor = rhs.cursor;
+    scheduled = 0;
     for( auto it = list.begin(), end = list.end(); it != end; ++it ) {
-        queue.emplace( it );
+        schedule( it );
     }
     return *this;
 }
 queued_eocs &queued_eocs::operator=( queued_eocs &&rhs ) noexcept
 {
-    queue.swap( rhs.queue );
     list.swap( rhs.list );
+    std::swap( cursor, rhs.cursor );
+    std::swap( scheduled, rhs.scheduled );
+    wheel.swap( rhs.wheel );
+    overflow.swap( rhs.overflow );
     return *this;
 }
 
 bool queued_eocs::empty() const
 {
-    return queue.empty();
+    return scheduled == 0;
 }
 
 const queued_eoc &queued_eocs::top() const
 {
-    return *queue.top();
+    const std::pair<const slot *, size_t> found = find_top();
+    return *( *found.first )[found.second];
 }
 
 void queued_eocs::push( const queued_eoc &eoc )
 {
-    auto it = list.emplace( list.end(), eoc );
-    queue.push( it );
+    schedule( list.emplace( list.end(), eoc ) );
 }
 
 void queued_eocs::pop()
 {
-    auto it = queue.top();
-    queue.pop();
+    const std::pair<const slot *, size_t> found = find_top();
+    slot &s = *const_cast<slot *>( found.first );
+    storage_iter it = s[found.second];
+    s[found.second] = s.back();
+    s.pop_back();
+    --scheduled;
     list.erase( it );
 }
 
+void queued_eocs::schedule( storage_iter it )
+{
+    place( it );
+    ++scheduled;
+}
+
+void queued_eocs::take_due( const time_point &now, std::vector<storage_iter> &due )
+{
+    const int64_t turn = to_turn<int64_t>( now );
+    if( scheduled == 0 ) {
+        cursor = turn;
+        return;
+    }
+    if( turn < cursor ) {
+        // Time went backwards (tests, debug menu), so the wheel no longer
+        // matches the clock.
+        rebuild( turn );
+    }
+    while( true ) {
+        // Everything in the cursor's slot is due: either it was scheduled for
+        // this very turn or it was already late when it got here.
+        slot &current = wheel[0][cursor & ( wheel_slots - 1 )];
+        scheduled -= current.size();
+        due.insert( due.end(), current.begin(), current.end() );
+        current.clear();
+
+        // Find the earliest turn anything else can be due at.  Slots below the
+        // cursor's own on each level are empty, so the first occupied one after
+        // it bounds every entry on that level and all levels above it.
+        std::optional<int64_t> next;
+        for( int level = 0; level < wheel_levels && !next; ++level ) {
+            const int shift = wheel_bits * level;
+            const int64_t block = cursor & ~( ( int64_t( 1 ) << ( shift + wheel_bits ) ) - 1 );
+            for( int64_t i = ( ( cursor >> shift ) & ( wheel_slots - 1 ) ) + 1; i < wheel_slots; ++i ) {
+                if( !wheel[level][i].empty() ) {
+                    next = block | ( i << shift );
+                    break;
+                }
+            }
+        }
+        if( !next && !overflow.empty() ) {
+            const int shift = wheel_bits * wheel_levels;
+            next = ( cursor | ( ( int64_t( 1 ) << shift ) - 1 ) ) + 1;
+        }
+        if( !next || *next > turn ) {
+            advance_to( turn );
+            return;
+        }
+        advance_to( *next );
+    }
+}
+
+void queued_eocs::place( storage_iter it )
+{
+    const int64_t t = to_turn<int64_t>( it->time );
+    if( t <= cursor ) {
+        wheel[0][cursor & ( wheel_slots - 1 )].push_back( it );
+        return;
+    }
+    // An entry goes on the lowest level whose slots span the turn it is due
+    // on and the cursor's turn alike.
+    for( int level = 0; level < wheel_levels; ++level ) {
+        const int shift = wheel_bits * level;
+        if( ( t >> ( shift + wheel_bits ) ) == ( cursor >> ( shift + wheel_bits ) ) ) {
+            wheel[level][( t >> shift ) & ( wheel_slots - 1 )].push_back( it );
+            return;
+        }
+    }
+    overflow.push_back( it );
+}
+
+void queued_eocs::advance_to( int64_t turn )
+{
+    // Nothing is scheduled before turn, so the only entries whose place changes
+    // are those in the slot turn enters on the highest level it moves on.
+    int level = 0;
+    while( level < wheel_levels &&
+           ( turn >> ( wheel_bits * ( level + 1 ) ) ) != ( cursor >> ( wheel_bits * ( level + 1 ) ) ) ) {
+        ++level;
+    }
+    cursor = turn;
+    if( level == 0 ) {
+        return;
+    }
+    slot moved;
+    if( level < wheel_levels ) {
+        moved.swap( wheel[level][( turn >> ( wheel_bits * level ) ) & ( wheel_slots - 1 )] );
+    } else {
+        moved.swap( overflow );
+    }
+    for( storage_iter &it : moved ) {
+        place( it );
+    }
+}
+
+void queued_eocs::rebuild( int64_t turn )
+{
+    slot moved;
+    moved.reserve( scheduled );
+    for( std::array<slot, wheel_slots> &level : wheel ) {
+        for( slot &s : level ) {
+            moved.insert( moved.end(), s.begin(), s.end() );
+            s.clear();
+        }
+    }
+    moved.insert( moved.end(), overflow.begin(), overflow.end() );
+    overflow.clear();
+    cursor = turn;
+    for( storage_iter &it : moved ) {
+        place( it );
+    }
+}
+
+std::pair<const queued_eocs::slot *, size_t> queued_eocs::find_top() const
+{
+    // Every entry on a level is due before every entry on the levels above
+    // it, and within a level the slots are in order, so the earliest entry is
+    // in the first occupied slot.
+    const slot *found = nullptr;
+    for( int level = 0; level < wheel_levels && !found; ++level ) {
+        const int shift = wheel_bits * level;
+        for( int64_t i = ( cursor >> shift ) & ( wheel_slots - 1 ); i < wheel_slots; ++i ) {
+            if( !wheel[level][i].empty() ) {
+                found = &wheel[level][i];
+                break;
+            }
+        }
+    }
+    if( !found ) {
+        found = &overflow;
+    }
+    size_t best = 0;
+    for( size_t i = 1; i < found->size(); ++i ) {
+        if( ( *found )[i]->time < ( *found )[best]->time ) {
+            best = i;
+        }
+    }
+    return { found, best };
+}
+
 void Character::queue_effects( const std::vector<effect_on_condition_id> &effects )
 {
     for( const effect_on_condition_id &eoc_id : effects ) {
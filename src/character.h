@@ -3,6 +3,7 @@
 #define CATA_SRC_CHARACTER_H
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <climits>
 #include <cstdint>
@@ -315,36 +316,57 @@ struct queued_eoc {
         global_variables::impl_t context;
 };
 
-struct eoc_compare {
-    bool operator()( const queued_eoc &lhs, const queued_eoc &rhs ) const {
-        return lhs.time > rhs.time;
-    }
-};
-
+// Queued effect_on_conditions, scheduled on a hierarchical timing wheel.
+// Level 0 has one slot per turn for the current block of 64 turns, and each
+// further level has one slot per block of the level below, so inserting an
+// entry and expiring a due one are both constant time.  Entries due more than
+// 64^4 turns ahead wait in an overflow list until the wheel reaches them.
 struct queued_eocs {
-    using storage_iter = std::list<queued_eoc>::iterator;
+    public:
+        using storage_iter = std::list<queued_eoc>::iterator;
 
-    struct eoc_compare : ::eoc_compare {
-        bool operator()( const storage_iter &lhs, const storage_iter &rhs ) const {
-            return ::eoc_compare::operator()( *lhs, *rhs );
-        }
-    };
-    std::priority_queue<storage_iter, std::vector<storage_iter>, eoc_compare> queue;
-    std::list<queued_eoc> list;
+        std::list<queued_eoc> list;
 
-    queued_eocs();
+        queued_eocs();
 
-    queued_eocs( const queued_eocs &rhs );
-    queued_eocs( queued_eocs &&rhs ) noexcept;
+        queued_eocs( const queued_eocs &rhs );
+        queued_eocs( queued_eocs &&rhs ) noexcept;
 
-    queued_eocs &operator=( const queued_eocs &rhs );
-    queued_eocs &operator=( queued_eocs &&rhs ) noexcept;
+        queued_eocs &operator=( const queued_eocs &rhs );
+        queued_eocs &operator=( queued_eocs &&rhs ) noexcept;
 
-    /* std::priority_queue compatibility layer */
-    bool empty() const;
-    const queued_eoc &top() const;
-    void push( const queued_eoc &eoc );
-    void pop();
+        /* std::priority_queue compatibility layer */
+        bool empty() const;
+        const queued_eoc &top() const;
+        void push( const queued_eoc &eoc );
+        void pop();
+
+        /**
+         * Unschedules every entry due at or before @p now and appends it to @p due.
+         * The entries stay in list; the caller either erases them or hands them
+         * back to schedule() once their new time is set.
+         */
+        void take_due( const time_point &now, std::vector<storage_iter> &due );
+        /** Schedules an entry of list that is not currently scheduled. */
+        void schedule( storage_iter it );
+
+    private:
+        static constexpr int wheel_bits = 6;
+        static constexpr int64_t wheel_slots = int64_t( 1 ) << wheel_bits;
+        static constexpr int wheel_levels = 4;
+        using slot = std::vector<storage_iter>;
+
+        void place( storage_iter it );
+        void advance_to( int64_t turn );
+        void rebuild( int64_t turn );
+        // The slot holding the earliest scheduled entry, and its index in there
+        std::pair<const slot *, size_t> find_top() const;
+
+        // Turn the wheel is positioned at.  Entries due before it sit in its slot.
+        int64_t cursor = 0;
+        size_t scheduled = 0;
+        std::array<std::array<slot, wheel_slots>, wheel_levels> wheel;
+        slot overflow;
 };
 
 struct aim_type {
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdlib>
 #include <functional>
 #include <iosfwd>
 #include <iterator>
@@ -38,6 +39,7 @@
 #include "memory_fast.h"
 #include "output.h"
 #include "path_info.h"
+#include "perf.h"
 #include "string_formatter.h"
 #include "translations.h"
 #include "uilist.h"
@@ -111,6 +113,10 @@ void zone_manager::clear()
     // Do not clear types since it is needed for the next games.
     area_cache.clear();
     vzone_cache.clear();
+    area_buckets.clear();
+    vzone_buckets.clear();
+    item_zone_type_cache.clear();
+    zone_lookup_dirty = true;
 }
 
 std::string zone_type::name() const
@@ -1003,6 +1009,9 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
 void zone_manager::cache_data( bool update_avatar )
 {
     area_cache.clear();
+    item_zone_type_cache.clear();
+    area_buckets.clear();
+    zone_lookup_dirty = true;
     avatar &player_character = get_avatar();
     tripoint_abs_ms cached_shift = player_character.pos_abs();
     for( zone_data &elem : zones ) {
@@ -1018,11 +1027,14 @@ void zone_manager::cache_data( bool update_avatar )
 
         const std::string &type_hash = elem.get_type_hash();
         auto &cache = area_cache[type_hash];
+        point_buckets &buckets = area_buckets[type_hash];
 
         // Draw marked area
         for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
                  elem.get_start_point(), elem.get_end_point() ) ) {
-            cache.insert( p );
+            if( cache.insert( p ).second ) {
+                buckets[project_to<coords::sm>( p )].push_back( p );
+            }
         }
     }
 }
@@ -1057,7 +1069,12 @@ void zone_manager::cache_avatar_location()
 
 void zone_manager::cache_vzones( map *pmap )
 {
+    // This runs every turn while vehicles move, so answers for items are only
+    // dropped when the vehicle zones actually end up somewhere else
+    const std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> previous_vzones =
+                std::move( vzone_cache );
     vzone_cache.clear();
+    vzone_buckets.clear();
     map &here = pmap == nullptr ? get_map() : *pmap;
     auto vzones = here.get_vehicle_zones( here.get_abs_sub().z() );
     for( zone_data *elem : vzones ) {
@@ -1067,26 +1084,79 @@ void zone_manager::cache_vzones( map *pmap )
 
         const std::string &type_hash = elem->get_type_hash();
         auto &cache = vzone_cache[type_hash];
+        point_buckets &buckets = vzone_buckets[type_hash];
 
         // TODO: looks very similar to the above cache_data - maybe merge it?
 
         // Draw marked area
         for( const tripoint_abs_ms &p : tripoint_range<tripoint_abs_ms>(
                  elem->get_start_point(), elem->get_end_point() ) ) {
-            cache.insert( p );
+            if( cache.insert( p ).second ) {
+                buckets[project_to<coords::sm>( p )].push_back( p );
+            }
         }
     }
+    if( vzone_cache != previous_vzones ) {
+        item_zone_type_cache.clear();
+    }
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_point_set( const zone_type_id &type,
-        const faction_id &fac ) const
+// Chebyshev distance from p to the closest tile of the submap sm.
+static int square_dist_to_submap( const tripoint_abs_ms &p, const tripoint_abs_sm &sm )
 {
-    const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
-    if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
+    const tripoint_abs_ms low = project_to<coords::ms>( sm );
+    const tripoint_abs_ms high = low + tripoint_rel_ms( SEEX - 1, SEEY - 1, 0 );
+    const int dx = std::max( { low.x() - p.x(), p.x() - high.x(), 0 } );
+    const int dy = std::max( { low.y() - p.y(), p.y() - high.y(), 0 } );
+    return std::max( { dx, dy, std::abs( p.z() - sm.z() ) } );
+}
+
+// Calls f on every point of the type_hash buckets within range of where, until f returns true.
+template<typename Buckets, typename F>
+static bool find_point_near( const Buckets &buckets, const std::string &type_hash,
+                             const tripoint_abs_ms &where, int range, const F &f )
+{
+    const auto type_iter = buckets.find( type_hash );
+    if( type_iter == buckets.end() ) {
+        return false;
+    }
+    for( const auto &bucket : type_iter->second ) {
+        if( square_dist_to_submap( where, bucket.first ) > range ) {
+            continue;
+        }
+        for( const tripoint_abs_ms &point : bucket.second ) {
+            if( square_dist( point, where ) <= range && f( point ) ) {
+                return true;
+            }
+        }
     }
+    return false;
+}
 
-    return type_iter->second;
+const zone_manager::zone_lookup_entry *zone_manager::get_zone_lookup( const zone_type_id &type,
+        const faction_id &fac ) const
+{
+    // zones can shrink without a call to cache_data, see remove
+    if( zone_lookup_dirty || zone_lookup_size != zones.size() ) {
+        zone_lookup.clear();
+        for( size_t i = 0; i < zones.size(); ++i ) {
+            const zone_data &zone = zones[i];
+            zone_lookup_entry &entry = zone_lookup[zone.get_type_hash()];
+            if( zone.get_is_personal() ) {
+                entry.personal.push_back( i );
+                continue;
+            }
+            for( const tripoint_abs_sm &sm : tripoint_range<tripoint_abs_sm>(
+                     project_to<coords::sm>( zone.get_start_point() ),
+                     project_to<coords::sm>( zone.get_end_point() ) ) ) {
+                entry.by_submap[sm].push_back( i );
+            }
+        }
+        zone_lookup_dirty = false;
+        zone_lookup_size = zones.size();
+    }
+    const auto type_iter = zone_lookup.find( zone_data::make_type_hash( type, fac ) );
+    return type_iter == zone_lookup.end() ? nullptr : &type_iter->second;
 }
 
 std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const tripoint_abs_ms &where,
@@ -1137,18 +1207,6 @@ std::unordered_set<tripoint_bub_ms> zone_manager::get_point_set_loot( const trip
     return res;
 }
 
-std::unordered_set<tripoint_abs_ms> zone_manager::get_vzone_set( const zone_type_id &type,
-        const faction_id &fac ) const
-{
-    //Only regenerate the vehicle zone cache if any vehicles have moved
-    const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
-    if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint_abs_ms>();
-    }
-
-    return type_iter->second;
-}
-
 bool zone_manager::has_terrain( const zone_type_id &type, const tripoint_abs_ms &where,
                                 const faction_id &fac ) const
 {
@@ -1172,23 +1230,15 @@ bool zone_manager::has( const zone_type_id &type, const tripoint_abs_ms &where,
 bool zone_manager::has_near( const zone_type_id &type, const tripoint_abs_ms &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            return true;
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    const auto any_point = []( const tripoint_abs_ms & ) {
+        return true;
+    };
+    const auto same_z = [&where]( const tripoint_abs_ms & point ) {
+        return point.z() == where.z();
+    };
+    return find_point_near( area_buckets, type_hash, where, range, any_point ) ||
+           find_point_near( vzone_buckets, type_hash, where, range, same_z );
 }
 
 std::vector<zone_data const *> zone_manager::get_near_zones( const zone_type_id &type,
@@ -1247,9 +1297,19 @@ std::vector<zone_data const *> zone_manager::get_zones_at( const tripoint_abs_ms
         const zone_type_id &type, const faction_id &fac ) const
 {
     std::vector<zone_data const *> ret;
-    for( const zone_data &zone : zones ) {
-        if( zone.has_inside( where ) && zone.get_type() == type && zone.get_faction() == fac ) {
-            ret.emplace_back( &zone );
+    if( const zone_lookup_entry *lookup = get_zone_lookup( type, fac ) ) {
+        std::vector<size_t> candidates = lookup->personal;
+        const auto bucket = lookup->by_submap.find( project_to<coords::sm>( where ) );
+        if( bucket != lookup->by_submap.end() ) {
+            candidates.insert( candidates.end(), bucket->second.begin(), bucket->second.end() );
+        }
+        // Keep the order of zones, get_zone_at returns the first match.
+        std::sort( candidates.begin(), candidates.end() );
+        for( const size_t i : candidates ) {
+            const zone_data &zone = zones[i];
+            if( zone.has_inside( where ) && zone.get_type() == type && zone.get_faction() == fac ) {
+                ret.emplace_back( &zone );
+            }
         }
     }
     map &here = get_map();
@@ -1303,29 +1363,21 @@ bool zone_manager::custom_loot_has( const tripoint_abs_ms &where, const item *it
 std::unordered_set<tripoint_abs_ms> zone_manager::get_near( const zone_type_id &type,
         const tripoint_abs_ms &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
     std::unordered_set<tripoint_abs_ms> near_point_set;
-
-    for( const tripoint_abs_ms &point : point_set ) {
-        if( square_dist( point, where ) <= range ) {
-            if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                near_point_set.insert( point );
-            }
+    const auto add_point = [&]( const tripoint_abs_ms & point ) {
+        if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
+            ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
+            near_point_set.insert( point );
         }
-    }
+        return false;
+    };
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &point : vzone_set ) {
-        if( point.z() == where.z() ) {
-            if( square_dist( point, where ) <= range ) {
-                if( ( type != zone_type_LOOT_CUSTOM && type != zone_type_LOOT_ITEM_GROUP ) ||
-                    ( it != nullptr && custom_loot_has( point, it, type, fac ) ) ) {
-                    near_point_set.insert( point );
-                }
-            }
-        }
-    }
+    find_point_near( area_buckets, type_hash, where, range, add_point );
+    find_point_near( vzone_buckets, type_hash, where, range,
+    [&where, &add_point]( const tripoint_abs_ms & point ) {
+        return point.z() == where.z() && add_point( point );
+    } );
 
     return near_point_set;
 }
@@ -1339,26 +1391,28 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 
     tripoint_abs_ms nearest_pos( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint_abs_ms> &point_set = get_point_set( type, fac );
-    for( const tripoint_abs_ms &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    for( const std::unordered_map<std::string, point_buckets> *buckets : {
+             &area_buckets, &vzone_buckets
+         } ) {
+        const auto type_iter = buckets->find( type_hash );
+        if( type_iter == buckets->end() ) {
+            continue;
         }
-    }
-
-    const std::unordered_set<tripoint_abs_ms> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint_abs_ms &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+        for( const std::pair<const tripoint_abs_sm, std::vector<tripoint_abs_ms>> &bucket :
+             type_iter->second ) {
+            if( square_dist_to_submap( where, bucket.first ) >= nearest_dist ) {
+                continue;
+            }
+            for( const tripoint_abs_ms &p : bucket.second ) {
+                int cur_dist = square_dist( p, where );
+                if( cur_dist < nearest_dist ) {
+                    nearest_dist = cur_dist;
+                    nearest_pos = p;
+                    if( nearest_dist == 0 ) {
+                        return nearest_pos;
+                    }
+                }
             }
         }
     }
@@ -1371,8 +1425,7 @@ std::optional<tripoint_abs_ms> zone_manager::get_nearest( const zone_type_id &ty
 zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
         const tripoint_abs_ms &where, int range, const faction_id &fac ) const
 {
-    const item_category &cat = it.get_category_of_contents();
-
+    // Custom and item group zones filter on anything about the item, so they are not cached.
     if( has_near( zone_type_LOOT_CUSTOM, where, range, fac ) ) {
         if( !get_near( zone_type_LOOT_CUSTOM, where, range, &it, fac ).empty() ) {
             return zone_type_LOOT_CUSTOM;
@@ -1383,36 +1436,15 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
             return zone_type_LOOT_ITEM_GROUP;
         }
     }
-    if( it.has_flag( json_flag_FIREWOOD ) ) {
-        if( has_near( zone_type_LOOT_WOOD, where, range, fac ) ) {
-            return zone_type_LOOT_WOOD;
-        }
-    }
-    if( it.is_corpse() ) {
-        if( has_near( zone_type_LOOT_CORPSE, where, range, fac ) ) {
-            return zone_type_LOOT_CORPSE;
-        }
-    }
-    if( it.typeId() == itype_disassembly ) {
-        if( has_near( zone_type_DISASSEMBLE, where, range, fac ) ) {
-            return zone_type_DISASSEMBLE;
-        }
-    }
-
-    std::optional<zone_type_id> zone_check_first = cat.priority_zone( it );
-    if( zone_check_first && has_near( *zone_check_first, where, range, fac ) ) {
-        return *zone_check_first;
-    }
 
-    std::optional<zone_type_id> zone_cat = cat.zone();
-    if( zone_cat && has_near( *zone_cat, where, range, fac ) ) {
-        return *cat.zone();
-    }
+    const item_category &cat = it.get_category_of_contents();
+    const std::optional<zone_type_id> zone_check_first = cat.priority_zone( it );
 
+    bool is_food = false;
+    bool is_drink = false;
+    bool perishable = false;
     if( cat.get_id() == item_category_food ) {
-
         const item *it_food = nullptr;
-        bool perishable = false;
         // Look for food, and whether any contents which will spoil if left out.
         // Food crafts and food without comestible, like MREs, will fall down to LOOT_FOOD.
         it.visit_items( [&it_food, &perishable]( const item * node, const item * parent ) {
@@ -1434,9 +1466,52 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
             }
             return VisitResponse::NEXT;
         } );
+        is_food = it_food != nullptr;
+        is_drink = is_food && it_food->get_comestible()->comesttype == "DRINK";
+    }
+
+    // Everything below only depends on these properties of the item, so identical
+    // items on the same tile share one answer until the zones change.
+    const bool firewood = it.has_flag( json_flag_FIREWOOD );
+    const bool corpse = it.is_corpse();
+    const bool disassembly = it.typeId() == itype_disassembly;
+    const item_zone_type_key key( where, range, fac, cat.get_id(),
+                                  zone_check_first.value_or( zone_type_id::NULL_ID() ),
+                                  firewood | ( corpse << 1 ) | ( disassembly << 2 ) |
+                                  ( is_food << 3 ) | ( is_drink << 4 ) | ( perishable << 5 ) );
+    static cata_cache_stats &stats = cata_cache_stats::get( "zone type cache for items" );
+    if( item_zone_type_cache.size() > 4096 ) {
+        item_zone_type_cache.clear();
+    }
+    const auto cached = item_zone_type_cache.find( key );
+    if( cached != item_zone_type_cache.end() ) {
+        stats.hits++;
+        return cached->second;
+    }
+    stats.misses++;
+
+    const auto classify = [&]() -> zone_type_id {
+        if( firewood && has_near( zone_type_LOOT_WOOD, where, range, fac ) ) {
+            return zone_type_LOOT_WOOD;
+        }
+        if( corpse && has_near( zone_type_LOOT_CORPSE, where, range, fac ) ) {
+            return zone_type_LOOT_CORPSE;
+        }
+        if( disassembly && has_near( zone_type_DISASSEMBLE, where, range, fac ) ) {
+            return zone_type_DISASSEMBLE;
+        }
+
+        if( zone_check_first && has_near( *zone_check_first, where, range, fac ) ) {
+            return *zone_check_first;
+        }
 
-        if( it_food != nullptr ) {
-            if( it_food->get_comestible()->comesttype == "DRINK" ) {
+        std::optional<zone_type_id> zone_cat = cat.zone();
+        if( zone_cat && has_near( *zone_cat, where, range, fac ) ) {
+            return *zone_cat;
+        }
+
+        if( cat.get_id() == item_category_food ) {
+            if( is_drink ) {
                 if( perishable && has_near( zone_type_LOOT_PDRINK, where, range, fac ) ) {
                     if( !get_near( zone_type_LOOT_PDRINK, where, range, &it, fac ).empty() ) {
                         return zone_type_LOOT_PDRINK;
@@ -1448,24 +1523,25 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
                 }
             }
 
-            if( perishable && has_near( zone_type_LOOT_PFOOD, where, range, fac ) ) {
+            if( is_food && perishable && has_near( zone_type_LOOT_PFOOD, where, range, fac ) ) {
                 if( !get_near( zone_type_LOOT_PFOOD, where, range, &it, fac ).empty() ) {
                     return zone_type_LOOT_PFOOD;
                 }
             }
+            if( !get_near( zone_type_LOOT_FOOD, where, range, &it, fac ).empty() ) {
+                return zone_type_LOOT_FOOD;
+            }
         }
-        if( !get_near( zone_type_LOOT_FOOD, where, range, &it, fac ).empty() ) {
-            return zone_type_LOOT_FOOD;
-        }
-    }
 
-    if( has_near( zone_type_LOOT_DEFAULT, where, range, fac ) ) {
-        if( !get_near( zone_type_LOOT_DEFAULT, where, range, &it, fac ).empty() ) {
-            return zone_type_LOOT_DEFAULT;
+        if( has_near( zone_type_LOOT_DEFAULT, where, range, fac ) ) {
+            if( !get_near( zone_type_LOOT_DEFAULT, where, range, &it, fac ).empty() ) {
+                return zone_type_LOOT_DEFAULT;
+            }
         }
-    }
 
-    return zone_type_id::NULL_ID();
+        return zone_type_id::NULL_ID();
+    };
+    return item_zone_type_cache.emplace( key, classify() ).first->second;
 }
 
 std::vector<zone_data> zone_manager::get_zones( const zone_type_id &type,
@@ -1652,6 +1728,7 @@ void zone_manager::swap( zone_data &a, zone_data &b )
         return;
     }
     std::swap( a, b );
+    zone_lookup_dirty = true;
 }
 
 namespace
@@ -1779,6 +1856,7 @@ void zone_manager::serialize( JsonOut &json ) const
 void zone_manager::deserialize( const JsonValue &jv )
 {
     jv.read( zones );
+    zone_lookup_dirty = true;
     for( auto it = zones.begin(); it != zones.end(); ) {
         // need to keep track of number of personal zones on reload
         if( it->get_is_personal() ) {
@@ -10,6 +10,7 @@
 #include <set>
 #include <string>
 #include <string_view>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -18,6 +19,7 @@
 #include "coordinates.h"
 #include "cuboid_rectangle.h"
 #include "game.h"
+#include "hash_utils.h"
 #include "map_scale_constants.h"
 #include "memory_fast.h"
 #include "point.h"
@@ -608,10 +610,34 @@ class zone_manager
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> area_cache;
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<std::string, std::unordered_set<tripoint_abs_ms>> vzone_cache;
-        std::unordered_set<tripoint_abs_ms> get_point_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint_abs_ms> get_vzone_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
+        // The points of area_cache and vzone_cache again, bucketed by submap so that
+        // range queries can skip every submap that is out of range.
+        using point_buckets = std::unordered_map<tripoint_abs_sm, std::vector<tripoint_abs_ms>>;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, point_buckets> area_buckets;
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<std::string, point_buckets> vzone_buckets;
+        // Indices into zones, by type hash. Regular zones are listed in every submap they
+        // overlap, personal zones move with the avatar and are kept aside.
+        struct zone_lookup_entry {
+            std::unordered_map<tripoint_abs_sm, std::vector<size_t>> by_submap;
+            std::vector<size_t> personal;
+        };
+        // Built on demand and dropped whenever zones are added, removed, moved or reordered.
+        // NOLINTNEXTLINE(cata-serialize)
+        mutable std::unordered_map<std::string, zone_lookup_entry> zone_lookup;
+        mutable bool zone_lookup_dirty = true; // NOLINT(cata-serialize)
+        mutable size_t zone_lookup_size = 0; // NOLINT(cata-serialize)
+        const zone_lookup_entry *get_zone_lookup( const zone_type_id &type,
+                const faction_id &fac ) const;
+        // Position, range, faction, category, priority zone and flag bits of the item.
+        using item_zone_type_key = std::tuple<tripoint_abs_ms, int, faction_id, item_category_id,
+              zone_type_id, int>;
+        // Answers of get_near_zone_type_for_item, dropped whenever the zones or the
+        // vehicle zones change.  Hit rates are kept in cata_cache_stats.
+        // NOLINTNEXTLINE(cata-serialize)
+        mutable std::unordered_map<item_zone_type_key, zone_type_id, cata::tuple_hash>
+        item_zone_type_cache;
     public:
         zone_manager();
         ~zone_manager() = default;
@@ -165,13 +165,13 @@ class computer
         // Miscellaneous key/value pairs.
         global_variables::impl_t values;
         // Methods for setting/getting misc key/value pairs.
-        void set_value( const std::string &key, diag_value value );
+        void set_value( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_value( const std::string &key, Args... args ) {
+        void set_value( const var_key &key, Args... args ) {
             set_value( key, diag_value{ std::forward<Args>( args )... } );
         }
-        void remove_value( const std::string &key );
-        diag_value const *maybe_get_value( const std::string &key ) const;
+        void remove_value( var_key_view key );
+        diag_value const *maybe_get_value( var_key_view key ) const;
 
         void remove_option( computer_action action );
 };
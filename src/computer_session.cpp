@@ -136,6 +136,8 @@ static const ter_str_id ter_t_water_pool( "t_water_pool" );
 
 static const trap_str_id tr_portal( "tr_portal" );
 
+static const oter_matcher oter_match_sewage_prefix( "sewage", ot_match_type::prefix );
+
 static catacurses::window init_window()
 {
     const int width = FULL_SCREEN_WIDTH;
@@ -708,7 +710,7 @@ void computer_session::action_map_sewer()
     helper_map(
     []( const oter_id & oter ) {
         return ( oter->get_type_id() == oter_type_sewer ) ||
-               is_ot_match( "sewage", oter, ot_match_type::prefix );
+               oter_match_sewage_prefix.matches( oter );
     },
     _( "Sewage map data downloaded.  Press any key…" ), COMPACT_MAP_SEWER );
 }
@@ -284,7 +284,7 @@ namespace
 {
 
 template<typename T>
-void _write_var_value( var_type type, const std::string &name, dialogue *d,
+void _write_var_value( var_type type, const var_key &name, dialogue *d,
                        T const &value )
 {
     global_variables &globvars = get_globals();
@@ -324,25 +324,25 @@ void _write_var_value( var_type type, const std::string &name, dialogue *d,
 
 } // namespace
 
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       std::string const &value )
 {
     _write_var_value( type, name, d, value );
 }
 
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       double value )
 {
     _write_var_value( type, name, d, value );
 }
 
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       tripoint_abs_ms const &value )
 {
     _write_var_value( type, name, d, value );
 }
 
-void write_var_value( var_type type, const std::string &name, dialogue *d,
+void write_var_value( var_type type, const var_key &name, dialogue *d,
                       diag_value const &value )
 {
     _write_var_value( type, name, d, value );
@@ -2203,22 +2203,22 @@ bool Creature::has_trait( const trait_id &/*flag*/ ) const
 }
 
 // Methods for setting/getting misc key/value pairs.
-void Creature::set_value( const std::string &key, diag_value value )
+void Creature::set_value( const var_key &key, diag_value value )
 {
     values[ key ] = std::move( value );
 }
 
-void Creature::remove_value( const std::string &key )
+void Creature::remove_value( var_key_view key )
 {
-    values.erase( key );
+    global_variables::_common_remove_value( key, values );
 }
 
-diag_value const &Creature::get_value( const std::string &key ) const
+diag_value const &Creature::get_value( var_key_view key ) const
 {
     return global_variables::_common_get_value( key, values );
 }
 
-diag_value const *Creature::maybe_get_value( const std::string &key ) const
+diag_value const *Creature::maybe_get_value( var_key_view key ) const
 {
     return global_variables::_common_maybe_get_value( key, values );
 }
@@ -701,14 +701,14 @@ class Creature : public viewer
         bool resists_effect( const effect &e ) const;
 
         // Methods for setting/getting misc key/value pairs.
-        void set_value( const std::string &key, diag_value value );
+        void set_value( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_value( const std::string &key, Args... args ) {
+        void set_value( const var_key &key, Args... args ) {
             set_value( key, diag_value{ std::forward<Args>( args )... } );
         }
-        void remove_value( const std::string &key );
-        diag_value const &get_value( const std::string &key ) const;
-        diag_value const *maybe_get_value( const std::string &key ) const;
+        void remove_value( var_key_view key );
+        diag_value const &get_value( var_key_view key ) const;
+        diag_value const *maybe_get_value( var_key_view key ) const;
         void clear_values();
 
         virtual units::mass get_weight() const = 0;
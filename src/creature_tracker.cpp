@@ -1,6 +1,7 @@
 #include "creature_tracker.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <string>
@@ -12,7 +13,9 @@
 #include "debug.h"
 #include "flood_fill.h"
 #include "game.h"
+#include "line.h"
 #include "map.h"
+#include "map_scale_constants.h"
 #include "mapdata.h"
 #include "maptile_fwd.h"
 #include "mongroup.h"
@@ -95,7 +98,8 @@ bool creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
     }
 
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.pos_abs()] = critter_ptr;
+    ++list_generation_;
+    set_location( critter.pos_abs(), critter_ptr );
     return true;
 }
 
@@ -132,8 +136,11 @@ bool creature_tracker::update_pos( const monster &critter, const tripoint_abs_ms
         return ptr.get() == &critter;
     } );
     if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( old_pos );
-        monsters_by_location[new_pos] = *iter;
+        if( const auto old_iter = monsters_by_location.find( old_pos );
+            old_iter != monsters_by_location.end() ) {
+            erase_location( old_iter );
+        }
+        set_location( new_pos, *iter );
         return true;
     } else {
         // We're changing the x/y/z coordinates of a zombie that hasn't been added
@@ -150,7 +157,7 @@ void creature_tracker::remove_from_location_map( const monster &critter )
 {
     const auto pos_iter = monsters_by_location.find( critter.pos_abs() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+        erase_location( pos_iter );
         return;
     }
 
@@ -161,8 +168,148 @@ void creature_tracker::remove_from_location_map( const monster &critter )
         return v.second.get() == &critter;
     } );
     if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+        erase_location( iter );
+    }
+}
+
+void creature_tracker::set_location( const tripoint_abs_ms &pos,
+                                     const shared_ptr_fast<monster> &critter )
+{
+    shared_ptr_fast<monster> &entry = monsters_by_location[pos];
+    if( entry == critter ) {
+        return;
+    }
+    const tripoint_abs_sm sm_pos = coords::project_to<coords::sm>( pos );
+    if( entry ) {
+        std::vector<monster *> &bucket = monsters_by_submap[sm_pos];
+        bucket.erase( std::remove( bucket.begin(), bucket.end(), entry.get() ), bucket.end() );
+    }
+    entry = critter;
+    monsters_by_submap[sm_pos].push_back( critter.get() );
+}
+
+void creature_tracker::erase_location(
+    std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>>::iterator iter )
+{
+    const auto bucket_iter = monsters_by_submap.find( coords::project_to<coords::sm>( iter->first ) );
+    if( bucket_iter != monsters_by_submap.end() ) {
+        std::vector<monster *> &bucket = bucket_iter->second;
+        const auto it = std::find( bucket.begin(), bucket.end(), iter->second.get() );
+        if( it != bucket.end() ) {
+            *it = bucket.back();
+            bucket.pop_back();
+        }
+        if( bucket.empty() ) {
+            monsters_by_submap.erase( bucket_iter );
+        }
     }
+    monsters_by_location.erase( iter );
+}
+
+void creature_tracker::for_each_in_cuboid( const tripoint_abs_ms &p_min,
+        const tripoint_abs_ms &p_max, const std::function<void( monster & )> &visit_fn ) const
+{
+    const int z_min = std::max( p_min.z(), -OVERMAP_DEPTH );
+    const int z_max = std::min( p_max.z(), OVERMAP_HEIGHT );
+    if( z_min > z_max || p_min.x() > p_max.x() || p_min.y() > p_max.y() ) {
+        return;
+    }
+    const point_abs_sm sm_min = coords::project_to<coords::sm>( p_min.xy() );
+    const point_abs_sm sm_max = coords::project_to<coords::sm>( p_max.xy() );
+
+    const auto visit_bucket = [&]( const std::vector<monster *> &bucket ) {
+        for( monster *critter : bucket ) {
+            const tripoint_abs_ms &pos = critter->pos_abs();
+            if( !critter->is_dead() &&
+                pos.x() >= p_min.x() && pos.x() <= p_max.x() &&
+                pos.y() >= p_min.y() && pos.y() <= p_max.y() &&
+                pos.z() >= z_min && pos.z() <= z_max ) {
+                visit_fn( *critter );
+            }
+        }
+    };
+
+    const int64_t num_submaps = static_cast<int64_t>( sm_max.x() - sm_min.x() + 1 ) *
+                                ( sm_max.y() - sm_min.y() + 1 ) * ( z_max - z_min + 1 );
+    if( num_submaps >= static_cast<int64_t>( monsters_by_submap.size() ) ) {
+        // Large area, cheaper to go through the occupied submaps.
+        for( const auto &[sm_pos, bucket] : monsters_by_submap ) {
+            if( sm_pos.x() >= sm_min.x() && sm_pos.x() <= sm_max.x() &&
+                sm_pos.y() >= sm_min.y() && sm_pos.y() <= sm_max.y() &&
+                sm_pos.z() >= z_min && sm_pos.z() <= z_max ) {
+                visit_bucket( bucket );
+            }
+        }
+        return;
+    }
+    for( int z = z_min; z <= z_max; z++ ) {
+        for( int y = sm_min.y(); y <= sm_max.y(); y++ ) {
+            for( int x = sm_min.x(); x <= sm_max.x(); x++ ) {
+                const auto bucket_iter = monsters_by_submap.find( tripoint_abs_sm( x, y, z ) );
+                if( bucket_iter != monsters_by_submap.end() ) {
+                    visit_bucket( bucket_iter->second );
+                }
+            }
+        }
+    }
+}
+
+void creature_tracker::for_each_in_radius( const tripoint_abs_ms &center, const int radius,
+        const std::function<void( monster & )> &visit_fn ) const
+{
+    if( radius < 0 ) {
+        return;
+    }
+    const tripoint_rel_ms offset( radius, radius, radius );
+    for_each_in_cuboid( center - offset, center + offset, [&]( monster & critter ) {
+        if( rl_dist( center, critter.pos_abs() ) <= radius ) {
+            visit_fn( critter );
+        }
+    } );
+}
+
+void creature_tracker::for_each_reachable_in_radius( const Creature &origin, const int radius,
+        const std::function<bool( const mfaction_id & )> &faction_fn,
+        const std::function<void( monster & )> &visit_fn )
+{
+    flood_fill_zone( origin );
+    const int zone = origin.get_reachable_zone();
+    for_each_in_radius( origin.pos_abs(), radius, [&]( monster & critter ) {
+        // Only the current flood fill counts, critter's own zone number may be left over
+        // from before an invalidation.
+        const auto member = zone_by_creature_.find( &critter );
+        if( member != zone_by_creature_.end() && member->second == zone &&
+            faction_fn( critter.get_monster_faction() ) ) {
+            visit_fn( critter );
+        }
+    } );
+}
+
+monster *creature_tracker::nearest_matching( const tripoint_abs_ms &center, const int radius,
+        const std::function<bool( const monster & )> &predicate ) const
+{
+    monster *nearest = nullptr;
+    int nearest_dist = std::numeric_limits<int>::max();
+    for_each_in_radius( center, radius, [&]( monster & critter ) {
+        const int dist = rl_dist( center, critter.pos_abs() );
+        if( dist < nearest_dist && predicate( critter ) ) {
+            nearest = &critter;
+            nearest_dist = dist;
+        }
+    } );
+    return nearest;
+}
+
+int creature_tracker::count_in_rect( const tripoint_abs_ms &p_min, const tripoint_abs_ms &p_max,
+                                     const std::function<bool( const monster & )> &predicate ) const
+{
+    int count = 0;
+    for_each_in_cuboid( p_min, p_max, [&]( monster & critter ) {
+        if( predicate( critter ) ) {
+            count++;
+        }
+    } );
+    return count;
 }
 
 void creature_tracker::remove( const monster &critter )
@@ -179,22 +326,27 @@ void creature_tracker::remove( const monster &critter )
     remove_from_location_map( critter );
     removed_this_turn_.emplace( *iter );
     monsters_list.erase( iter );
+    ++list_generation_;
 }
 
 void creature_tracker::clear()
 {
     monsters_list.clear();
+    ++list_generation_;
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     removed_this_turn_.clear();
     creatures_by_zone_and_faction_.clear();
+    zone_by_creature_.clear();
     invalidate_reachability_cache();
 }
 
 void creature_tracker::rebuild_cache()
 {
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->pos_abs()] = mon_ptr;
+        set_location( mon_ptr->pos_abs(), mon_ptr );
     }
 }
 
@@ -237,13 +389,13 @@ void creature_tracker::swap_positions( monster &first, monster &second )
     shared_ptr_fast<monster> first_ptr;
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
+        erase_location( first_iter );
     }
 
     shared_ptr_fast<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
+        erase_location( second_iter );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
@@ -253,10 +405,10 @@ void creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.pos_abs()] = first_ptr;
+        set_location( first.pos_abs(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.pos_abs()] = second_ptr;
+        set_location( second.pos_abs(), second_ptr );
     }
 }
 
@@ -293,6 +445,7 @@ void creature_tracker::remove_dead()
         if( critter->is_dead() ) {
             remove_from_location_map( *critter );
             iter = monsters_list.erase( iter );
+            ++list_generation_;
         } else {
             ++iter;
         }
@@ -350,6 +503,7 @@ void creature_tracker::flood_fill_zone( const Creature &origin )
 {
     if( dirty_ ) {
         creatures_by_zone_and_faction_.clear();
+        zone_by_creature_.clear();
         zone_tick_ = zone_tick_ > 0 ? -1 : 1;
         zone_number_ = 1;
         dirty_ = false;
@@ -412,6 +566,7 @@ void creature_tracker::flood_fill_zone( const Creature &origin )
             if( shared_ptr_fast<Creature> ptr = g->shared_from( *creature ) ) {
                 const int n = zone_number_ * zone_tick_;
                 creatures_by_zone_and_faction_[n][creature->get_monster_faction()].emplace_back( std::move( ptr ) );
+                zone_by_creature_[creature] = n;
                 creature->set_reachable_zone( n );
             }
         }
@@ -3,6 +3,8 @@
 #define CATA_SRC_CREATURE_TRACKER_H
 
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -70,6 +72,37 @@ class creature_tracker
         void for_each_reachable( const Creature &origin, FactionPredicateFn &&faction_fn,
                                  CreatureVisitFn &&creature_fn );
 
+        /**
+         * Visits all living monsters within @p radius (as per rl_dist) of @p center.
+         * Only monsters near @p center are looked at, so this is cheaper than going through
+         * all monsters. @p visit_fn must not add, remove or move monsters.
+         */
+        void for_each_in_radius( const tripoint_abs_ms &center, int radius,
+                                 const std::function<void( monster & )> &visit_fn ) const;
+        /**
+         * Returns the living monster closest to @p center (as per rl_dist) within @p radius
+         * that matches @p predicate, or nullptr if there is none.
+         */
+        monster *nearest_matching( const tripoint_abs_ms &center, int radius,
+                                   const std::function<bool( const monster & )> &predicate ) const;
+        /**
+         * Counts living monsters within the cuboid spanned by @p p_min and @p p_max (both inclusive)
+         * that match @p predicate.
+         */
+        int count_in_rect( const tripoint_abs_ms &p_min, const tripoint_abs_ms &p_max,
+                           const std::function<bool( const monster & )> &predicate ) const;
+
+        /**
+         * Visits the living monsters reachable from @p origin (see @ref for_each_reachable)
+         * that are within @p radius (as per rl_dist) of it and whose faction matches @p faction_fn.
+         * Unlike @ref for_each_reachable this only looks at monsters near @p origin,
+         * so its cost does not grow with the number of creatures in the zone.
+         * @p visit_fn must not add, remove or move monsters.
+         */
+        void for_each_reachable_in_radius( const Creature &origin, int radius,
+                                           const std::function<bool( const mfaction_id & )> &faction_fn,
+                                           const std::function<void( monster & )> &visit_fn );
+
         /**
          * Returns a temporary id of the given monster (which must exist in the tracker).
          * The id is valid until monsters are added or removed from the tracker.
@@ -87,6 +120,10 @@ class creature_tracker
          */
         bool add( const shared_ptr_fast<monster> &critter );
         size_t size() const;
+        /** Changes whenever a monster is added to or removed from @ref get_monsters_list. */
+        uint64_t list_generation() const {
+            return list_generation_;
+        }
         /** Updates the position of the given monster to the given point. Returns whether the operation
          *  was successful. */
         bool update_pos( const monster &critter, const tripoint_abs_ms &old_pos,
@@ -136,6 +173,14 @@ class creature_tracker
     private:
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
+        /** Puts the monster at the given location, keeping @ref monsters_by_submap in sync. */
+        void set_location( const tripoint_abs_ms &pos, const shared_ptr_fast<monster> &critter );
+        /** Erases the entry from @ref monsters_by_location and @ref monsters_by_submap. */
+        void erase_location(
+            std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>>::iterator iter );
+        /** Visits living monsters inside the cuboid, both corners inclusive. */
+        void for_each_in_cuboid( const tripoint_abs_ms &p_min, const tripoint_abs_ms &p_max,
+                                 const std::function<void( monster & )> &visit_fn ) const;
 
         void flood_fill_zone( const Creature &origin );
 
@@ -147,7 +192,15 @@ class creature_tracker
         std::list<shared_ptr_fast<npc>> active_npc; // NOLINT(cata-serialize)
         std::vector<shared_ptr_fast<monster>> monsters_list;
         // NOLINTNEXTLINE(cata-serialize)
+        uint64_t list_generation_ = 0;
+        // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<tripoint_abs_ms, shared_ptr_fast<monster>> monsters_by_location;
+        /**
+         * Spatial index of @ref monsters_by_location: the monsters in each submap.
+         * Only non-empty buckets are kept.
+         */
+        // NOLINTNEXTLINE(cata-serialize)
+        std::unordered_map<tripoint_abs_sm, std::vector<monster *>> monsters_by_submap;
 
         /**
          * Creatures that get removed via @ref remove are stored here until the end of the turn.
@@ -163,6 +216,11 @@ class creature_tracker
         int zone_number_ = 0;  // NOLINT(cata-serialize)
         std::unordered_map<int, std::unordered_map<mfaction_id, std::vector<shared_ptr_fast<Creature>>>>
         creatures_by_zone_and_faction_;  // NOLINT(cata-serialize)
+        // The zone each creature in @ref creatures_by_zone_and_faction_ was flood filled into.
+        // Zone numbers are reused after an invalidation, so a creature's own zone number can
+        // match the current one while being stale; this is the snapshot to check against.
+        // The pointers are kept alive by @ref creatures_by_zone_and_faction_.
+        std::unordered_map<const Creature *, int> zone_by_creature_;  // NOLINT(cata-serialize)
 
         friend game;
 };
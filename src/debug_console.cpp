@@ -4229,7 +4229,7 @@ static void draw_var_table( const char *table_id,
 
     int filtered_count = 0;
     for( const auto &kv : vars ) {
-        if( filter.empty() || kv.first.find( filter ) != std::string::npos ) {
+        if( filter.empty() || kv.first.str().find( filter ) != std::string::npos ) {
             filtered_count++;
         }
     }
@@ -4240,11 +4240,11 @@ static void draw_var_table( const char *table_id,
                            ImGuiTableFlags_NoSavedSettings |
                            ImGuiTableFlags_Sortable,
                            ImVec2( 0.0f, fit_table_height( filtered_count, height ) ) ) ) {
-        using var_row = const std::pair<const std::string, diag_value> *;
+        using var_row = const global_variables::impl_t::value_type *;
         std::vector<var_row> rows;
         rows.reserve( vars.size() );
         for( const auto &kv : vars ) {
-            if( !filter.empty() && kv.first.find( filter ) == std::string::npos ) {
+            if( !filter.empty() && kv.first.str().find( filter ) == std::string::npos ) {
                 continue;
             }
             rows.push_back( &kv );
@@ -4288,14 +4288,13 @@ static void draw_var_table( const char *table_id,
         if( ImGuiTableSortSpecs *sort_specs = ImGui::TableGetSortSpecs() ) {
             if( sort_specs->SpecsCount > 0 ) {
                 std::sort( rows.begin(), rows.end(),
-                           [&]( const std::pair<const std::string, diag_value> *a,
-                const std::pair<const std::string, diag_value> *b ) {
+                           [&]( var_row a, var_row b ) {
                     for( int i = 0; i < sort_specs->SpecsCount; i++ ) {
                         const ImGuiTableColumnSortSpecs &s = sort_specs->Specs[i];
                         int cmp = 0;
                         switch( s.ColumnIndex ) {
                             case 0:
-                                cmp = a->first.compare( b->first );
+                                cmp = a->first.str().compare( b->first.str() );
                                 break;
                             case 1: {
                                 auto rank = []( const diag_value & v ) {
@@ -4317,7 +4316,7 @@ static void draw_var_table( const char *table_id,
                                    ? cmp < 0 : cmp > 0;
                         }
                     }
-                    return a->first.compare( b->first ) < 0;
+                    return a->first.str().compare( b->first.str() ) < 0;
                 } );
             }
         }
@@ -4503,6 +4502,8 @@ void tab_data_view::draw_body( debug_console &host )
     framed_section( "data_export", "Export & print", [&]() {
         host.debug_button( debug_menu_index::WRITE_GLOBAL_EOCS );
         ImGui::SameLine();
+        host.debug_button( debug_menu_index::WRITE_EOC_COSTS );
+        ImGui::SameLine();
         host.debug_button( debug_menu_index::WRITE_GLOBAL_VARS );
         ImGui::SameLine();
         host.debug_button( debug_menu_index::WRITE_TIMED_EVENTS );
@@ -4600,7 +4601,7 @@ void tab_data_view::draw_var_browser( debug_console &/*host*/ )
     if( ImGui::SmallButton( "Copy all##vars" ) ) {
         std::string clipboard;
         for( const auto &[key, val] : get_globals().get_global_values() ) {
-            clipboard += key + ";" + val.to_string( true ) + "\n";
+            clipboard += key.str() + ";" + val.to_string( true ) + "\n";
         }
         ImGui::SetClipboardText( clipboard.c_str() );
     }
@@ -267,6 +267,7 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::QUICKLOAD: return "QUICKLOAD";
         case debug_menu::debug_menu_index::TEST_WEATHER: return "TEST_WEATHER";
         case debug_menu::debug_menu_index::WRITE_GLOBAL_EOCS: return "WRITE_GLOBAL_EOCS";
+        case debug_menu::debug_menu_index::WRITE_EOC_COSTS: return "WRITE_EOC_COSTS";
         case debug_menu::debug_menu_index::WRITE_GLOBAL_VARS: return "WRITE_GLOBAL_VARS";
         case debug_menu::debug_menu_index::EDIT_GLOBAL_VARS: return "SET_GLOBAL_VARS";
         case debug_menu::debug_menu_index::WRITE_TIMED_EVENTS: return "WRITE_TIMED_EVENTS";
@@ -1002,6 +1003,7 @@ static int info_uilist()
         { uilist_entry( debug_menu_index::PRINT_NPC_MAGIC, true, 'M', _( "Print NPC magic info to console" ) ) },
         { uilist_entry( debug_menu_index::TEST_WEATHER, true, 'W', _( "Test weather" ) ) },
         { uilist_entry( debug_menu_index::WRITE_GLOBAL_EOCS, true, 'C', _( "Write global effect_on_condition(s) to eocs.output" ) ) },
+        { uilist_entry( debug_menu_index::WRITE_EOC_COSTS, true, 'O', _( "Write queued effect_on_condition c(o)sts to eoc_costs.output" ) ) },
         { uilist_entry( debug_menu_index::WRITE_GLOBAL_VARS, true, 'G', _( "Write global var(s) to var_list.output" ) ) },
         { uilist_entry( debug_menu_index::WRITE_TIMED_EVENTS, true, 'E', _( "Write Timed (E)vents to timed_event_list.output" ) ) },
         { uilist_entry( debug_menu_index::EDIT_GLOBAL_VARS, true, 'a', _( "Edit global v(a)rs" ) ) },
@@ -2771,7 +2773,7 @@ static void character_edit_menu()
                 testfile << "|;key;value;" << std::endl;
 
                 for( const auto &value : you.get_values() ) {
-                    testfile << "|;" << value.first << ";" << value.second.to_string() << ";" << std::endl;
+                    testfile << "|;" << value.first.str() << ";" << value.second.to_string() << ";" << std::endl;
                 }
 
             }, "var_list" );
@@ -4082,7 +4084,7 @@ static void write_global_vars()
         testfile << "|;key;value;" << std::endl;
         global_variables::impl_t &globals = get_globals().get_global_values();
         for( const auto &value : globals ) {
-            testfile << "|;" << value.first << ";" << value.second.to_string() << ";" << std::endl;
+            testfile << "|;" << value.first.str() << ";" << value.second.to_string() << ";" << std::endl;
         }
 
     }, "var_list" );
@@ -4546,6 +4548,14 @@ const std::vector<debug_action_entry> &all_actions()
             },
             translate_marker( "Dump every global EOC definition to a file in the save dir" )
         },
+        {
+            debug_menu_index::WRITE_EOC_COSTS, translate_marker( "Write EOC costs" ), "eoc cost time profile recurring", "Data", []()
+            {
+                effect_on_conditions::write_queued_costs_to_file();
+                popup( _( "effect_on_condition costs written to eoc_costs.output" ) );
+            },
+            translate_marker( "Dump how often each queued EOC ran and how long it took, most expensive first" )
+        },
         {
             debug_menu_index::WRITE_TIMED_EVENTS, translate_marker( "Write timed events" ), "timed event write", "Data", []()
             {
@@ -96,6 +96,7 @@ enum class debug_menu_index : int {
     VEHICLE_EXPORT,
     GENERATE_EFFECT_LIST,
     WRITE_GLOBAL_EOCS,
+    WRITE_EOC_COSTS,
     WRITE_GLOBAL_VARS,
     EDIT_GLOBAL_VARS,
     ACTIVATE_EOC,
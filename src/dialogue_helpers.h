@@ -14,6 +14,7 @@
 
 #include "calendar.h"
 #include "translation.h"
+#include "var_key.h"
 
 class JsonObject;
 class JsonValue;
@@ -43,11 +44,11 @@ enum class var_type : int {
 # pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
 struct var_info {
-    var_info( var_type in_type, std::string in_name ): type( in_type ),
-        name( std::move( in_name ) ) {}
+    var_info( var_type in_type, var_key in_name ): type( in_type ),
+        name( in_name ) {}
     var_info() : type( var_type::last ) {}
     var_type type;
-    std::string name;
+    var_key name;
 
     void _deserialize( JsonObject const &jo );
     void deserialize( JsonValue const &jsin );
@@ -58,6 +58,7 @@
 #include "options.h"
 #include "output.h"
 #include "overmapbuffer.h"
+#include "perf.h"
 #include "pimpl.h"
 #include "player_activity.h"
 #include "point.h"
@@ -217,6 +218,7 @@ bool cleanup_at_end()
     sfx::fade_audio_group( sfx::group::context_themes, 300 );
     sfx::fade_audio_group( sfx::group::low_stamina, 300 );
 
+    cata_cache_stats::print_stats();
     zone_manager::get_manager().clear();
 
     MAPBUFFER.clear();
@@ -543,8 +545,8 @@ bool game::do_turn()
     }
     play_music( music::get_music_id_string() );
 
-    // starting a new turn, clear out temperature cache
-    weather.temperature_cache.clear();
+    // starting a new turn, clear out temperature and weather caches
+    weather.clear_temp_cache();
 
     if( npcs_dirty ) {
         load_npcs();
@@ -585,6 +587,21 @@ bool game::do_turn()
             overmap_buffer.move_nemesis();
         }
     }
+    // While the player sleeps or is busy with an activity, a pause goes
+    // unnoticed, so get the overmaps they are approaching ready ahead of time.
+    // Generating them when the player walks in stalls the game for a while.
+    if( ( u.in_sleep_state() || u.activity ) && calendar::once_every( 1_minutes ) ) {
+        overmap_buffer.prepare_overmap_near( u.pos_abs_omt(), OMAPX / 4 );
+    }
+    // When travelling by vehicle, generate the terrain ahead of it a bit at a
+    // time, rather than all at once when the map shifts onto it.
+    if( u.in_vehicle ) {
+        const vehicle *veh = veh_pointer_or_null( m.veh_at( u.pos_bub() ) );
+        if( veh != nullptr && veh->velocity != 0 ) {
+            const units::angle heading = veh->face.dir() + ( veh->velocity > 0 ? 0_degrees : 180_degrees );
+            m.pregenerate_ahead( heading );
+        }
+    }
 
     debug_hour_timer.print_time();
 
@@ -3,12 +3,13 @@
 #include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 #include <list>
 #include <memory>
 #include <unordered_map>
 #include <ostream>
-#include <queue>
+#include <vector>
 
 #include "avatar.h"
 #include "calendar.h"
@@ -244,65 +245,80 @@ void effect_on_conditions::queue_effect_on_condition( time_duration duration,
     }
 }
 
+static std::unordered_map<effect_on_condition_id, queued_eoc_cost> queued_eoc_costs;
+
 static void process_eocs( queued_eocs &eoc_queue, std::vector<effect_on_condition_id> &eoc_vector,
                           dialogue &d )
 {
     static int reentrancy_depth = 0;
     ++reentrancy_depth;
 
+    struct eoc_batch {
+        std::vector<queued_eocs::storage_iter> due;
+        std::vector<queued_eocs::storage_iter> to_queue;
+    };
     // Have to use a typedef because astyle does not settle on the spacing for the & when inline.
-    using queue_t = std::vector<queued_eocs::storage_iter> &;
-    queue_t eocs_to_queue = []() -> queue_t {
-        static std::list<std::vector<queued_eocs::storage_iter>> cached_queues;
+    using batch_t = eoc_batch &;
+    batch_t batch = []() -> batch_t {
+        static std::list<eoc_batch> cached_batches;
         if( reentrancy_depth < 0 )
         {
             debugmsg( "How can we unrecurse more than we recurse?" );
         }
-        while( cached_queues.size() < static_cast<size_t>( reentrancy_depth ) )
+        while( cached_batches.size() < static_cast<size_t>( reentrancy_depth ) )
         {
-            cached_queues.emplace_back();
+            cached_batches.emplace_back();
         }
-        auto it = cached_queues.begin();
+        auto it = cached_batches.begin();
         std::advance( it, reentrancy_depth - 1 );
         return *it;
     }();
 
     on_out_of_scope cleanup{ [&] {
             --reentrancy_depth;
-            eocs_to_queue.clear();
+            batch.due.clear();
+            batch.to_queue.clear();
         } };
 
-    while( !eoc_queue.empty() &&
-           eoc_queue.top().time <= calendar::turn ) {
-        queued_eocs::storage_iter it = eoc_queue.queue.top();
-        queued_eoc &top = *it;
-        eoc_queue.queue.pop();
+    // Everything due this turn comes off the wheel at once.  Running it can
+    // queue more eocs without delay, so keep going until nothing is left due.
+    eoc_queue.take_due( calendar::turn, batch.due );
+    while( !batch.due.empty() ) {
+        for( queued_eocs::storage_iter it : batch.due ) {
+            queued_eoc &top = *it;
 
-        dialogue nested_d{ d };
-        for( const auto &val : top.context ) {
-            nested_d.set_value( val.first, val.second );
-        }
-        bool activated = top.eoc->activate( nested_d );
-        if( top.eoc->type == eoc_type::RECURRING ) {
-            if( activated ) { // It worked so add it back
-                it->time = calendar::turn + next_recurrence( top.eoc, d );
-                eocs_to_queue.emplace_back( it );
-            } else {
-                if( !top.eoc->check_deactivate(
-                        nested_d ) ) { // It failed but shouldn't be deactivated so add it back
+            dialogue nested_d{ d };
+            for( const auto &val : top.context ) {
+                nested_d.set_value( val.first, val.second );
+            }
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            bool activated = top.eoc->activate( nested_d );
+            queued_eoc_cost &cost = queued_eoc_costs[top.eoc];
+            ++cost.runs;
+            cost.time += std::chrono::steady_clock::now() - start;
+            if( top.eoc->type == eoc_type::RECURRING ) {
+                if( activated ) { // It worked so add it back
                     it->time = calendar::turn + next_recurrence( top.eoc, d );
-                    eocs_to_queue.emplace_back( it );
-                } else { // It failed and should be deactivated for now
-                    eoc_vector.push_back( top.eoc );
-                    eoc_queue.list.erase( it );
+                    batch.to_queue.emplace_back( it );
+                } else {
+                    if( !top.eoc->check_deactivate(
+                            nested_d ) ) { // It failed but shouldn't be deactivated so add it back
+                        it->time = calendar::turn + next_recurrence( top.eoc, d );
+                        batch.to_queue.emplace_back( it );
+                    } else { // It failed and should be deactivated for now
+                        eoc_vector.push_back( top.eoc );
+                        eoc_queue.list.erase( it );
+                    }
                 }
+            } else {
+                eoc_queue.list.erase( it );
             }
-        } else {
-            eoc_queue.list.erase( it );
         }
+        batch.due.clear();
+        eoc_queue.take_due( calendar::turn, batch.due );
     }
-    for( queued_eocs::storage_iter &q_eoc : eocs_to_queue ) {
-        eoc_queue.queue.emplace( q_eoc );
+    for( queued_eocs::storage_iter &q_eoc : batch.to_queue ) {
+        eoc_queue.schedule( q_eoc );
     }
 }
 
@@ -506,6 +522,40 @@ void effect_on_conditions::write_global_eocs_to_file( )
     }, "eocs test file" );
 }
 
+const std::unordered_map<effect_on_condition_id, queued_eoc_cost> &
+effect_on_conditions::queued_costs()
+{
+    return queued_eoc_costs;
+}
+
+void effect_on_conditions::reset_queued_costs()
+{
+    queued_eoc_costs.clear();
+}
+
+void effect_on_conditions::write_queued_costs_to_file()
+{
+    write_to_file( "eoc_costs.output", []( std::ostream & testfile ) {
+        using cost_entry = std::pair<const effect_on_condition_id, queued_eoc_cost>;
+        std::vector<const cost_entry *> sorted;
+        sorted.reserve( queued_eoc_costs.size() );
+        for( const cost_entry &entry : queued_eoc_costs ) {
+            sorted.push_back( &entry );
+        }
+        std::sort( sorted.begin(), sorted.end(), []( const cost_entry * l, const cost_entry * r ) {
+            return l->second.time > r->second.time;
+        } );
+
+        testfile << "id;runs;total_us;mean_us" << std::endl;
+        for( const cost_entry *entry : sorted ) {
+            const int64_t total_us = std::chrono::duration_cast<std::chrono::microseconds>
+                                     ( entry->second.time ).count();
+            testfile << entry->first.c_str() << ";" << entry->second.runs << ";" << total_us << ";" <<
+                     total_us / std::max( entry->second.runs, 1 ) << std::endl;
+        }
+    }, "eoc costs file" );
+}
+
 void effect_on_conditions::prevent_death()
 {
     avatar &player_character = get_avatar();
@@ -559,6 +609,7 @@ void effect_on_conditions::reset()
 {
     effect_on_condition_factory.reset();
     pending_eoc_refs.clear();
+    reset_queued_costs();
 }
 
 void effect_on_conditions::load( const JsonObject &jo, const std::string &src )
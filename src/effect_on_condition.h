@@ -2,10 +2,12 @@
 #ifndef CATA_SRC_EFFECT_ON_CONDITION_H
 #define CATA_SRC_EFFECT_ON_CONDITION_H
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -77,6 +79,12 @@ struct effect_on_condition {
         void check() const;
         effect_on_condition() = default;
 };
+/** Time spent running one queued effect_on_condition, summed over every queue */
+struct queued_eoc_cost {
+    int runs = 0;
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+};
+
 namespace effect_on_conditions
 {
 /** Get all currently loaded effect_on_conditions */
@@ -108,6 +116,11 @@ void clear( Character &you );
 /** write out all queued eocs and inactive eocs to a file for testing */
 void write_eocs_to_file( Character &you );
 void write_global_eocs_to_file();
+/** Cost of every queued eoc run by process_effect_on_conditions this session */
+const std::unordered_map<effect_on_condition_id, queued_eoc_cost> &queued_costs();
+void reset_queued_costs();
+/** write out queued_costs(), most expensive first, to a file */
+void write_queued_costs_to_file();
 /** Run all prevent death eocs */
 void prevent_death();
 /** Run all avatar death eocs */
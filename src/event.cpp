@@ -1,8 +1,18 @@
 #include "event.h"
 
+#include <algorithm>
+#include <array>
+#include <numeric>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 #include "debug.h"
+#include "hash_utils.h"
+#include "int_id.h"
+#include "string_id.h"
 
 namespace io
 {
@@ -255,23 +265,195 @@ event::fields_type event::get_fields( event_type type )
                type, std::make_integer_sequence<int, static_cast<int>( event_type::num_event_types )> {} );
 }
 
+namespace
+{
+
+template<typename T>
+struct is_string_id : std::false_type {};
+template<typename T>
+struct is_string_id<string_id<T>> : std::true_type {};
+template<typename T>
+struct is_int_id : std::false_type {};
+template<typename T>
+struct is_int_id<int_id<T>> : std::true_type {};
+
+// The string a cata_variant would hold for the value.  Ids return their interned
+// string; only other values are written to buffer.
+template<cata_variant_type Type>
+std::string_view field_string( const event_detail::field_value &v, std::string &buffer )
+{
+    using T = event_detail::field_value_t<Type>;
+    const T &value = std::get<static_cast<size_t>( Type )>( v );
+    if constexpr( std::is_same_v<T, std::monostate> ) {
+        return {};
+    } else if constexpr( std::is_same_v<T, std::string> ) {
+        return value;
+    } else if constexpr( is_string_id<T>::value ) {
+        return value.str();
+    } else if constexpr( is_int_id<T>::value ) {
+        return value.id().str();
+    } else {
+        buffer = cata_variant_detail::convert<Type>::to_string( value );
+        return buffer;
+    }
+}
+
+template<cata_variant_type Type>
+cata_variant field_variant( const event_detail::field_value &v )
+{
+    if constexpr( Type == cata_variant_type::void_ ) {
+        return cata_variant();
+    } else {
+        return cata_variant::make<Type>( std::get<static_cast<size_t>( Type )>( v ) );
+    }
+}
+
+using field_string_fn = std::string_view( * )( const event_detail::field_value &, std::string & );
+using field_variant_fn = cata_variant( * )( const event_detail::field_value & );
+
+template<size_t... I>
+constexpr std::array<field_string_fn, sizeof...( I )> field_string_fns( std::index_sequence<I...> )
+{
+    return { { &field_string<static_cast<cata_variant_type>( I )>... } };
+}
+
+template<size_t... I>
+constexpr std::array<field_variant_fn, sizeof...( I )> field_variant_fns( std::index_sequence<I...> )
+{
+    return { { &field_variant<static_cast<cata_variant_type>( I )>... } };
+}
+
+constexpr size_t num_variant_types = static_cast<size_t>( cata_variant_type::num_types );
+
+std::string_view to_string_view( const event_detail::field_value &v, std::string &buffer )
+{
+    static constexpr std::array<field_string_fn, num_variant_types> fns =
+        field_string_fns( std::make_index_sequence<num_variant_types>() );
+    return fns[v.index()]( v, buffer );
+}
+
+cata_variant to_variant( const event_detail::field_value &v )
+{
+    static constexpr std::array<field_variant_fn, num_variant_types> fns =
+        field_variant_fns( std::make_index_sequence<num_variant_types>() );
+    return fns[v.index()]( v );
+}
+
+void hash_field( size_t &seed, const std::string_view key, cata_variant_type type,
+                 const std::string_view value )
+{
+    cata::hash_combine( seed, key );
+    cata::hash_combine( seed, static_cast<int>( type ) );
+    cata::hash_combine( seed, value );
+}
+
+} // namespace
+
+const event_detail::field_value *event::find_field( const std::string &key ) const
+{
+    for( size_t i = 0; i < num_fields_; ++i ) {
+        if( key == fields_[i].first ) {
+            return &payload_[i];
+        }
+    }
+    return nullptr;
+}
+
 cata_variant event::get_variant( const std::string &key ) const
 {
-    auto it = data_.find( key );
-    if( it == data_.end() ) {
-        cata_fatal( "No such key %s in event of type %s", key,
-                    io::enum_to_string( type_ ) );
+    if( const event_detail::field_value *value = find_field( key ) ) {
+        return to_variant( *value );
     }
-    return it->second;
+    if( data_ ) {
+        auto it = data_->find( key );
+        if( it != data_->end() ) {
+            return it->second;
+        }
+    }
+    cata_fatal( "No such key %s in event of type %s", key, io::enum_to_string( type_ ) );
 }
 
 cata_variant event::get_variant_or_void( const std::string &key ) const
 {
-    auto it = data_.find( key );
-    if( it == data_.end() ) {
-        return cata_variant();
+    if( const event_detail::field_value *value = find_field( key ) ) {
+        return to_variant( *value );
+    }
+    if( data_ ) {
+        auto it = data_->find( key );
+        if( it != data_->end() ) {
+            return it->second;
+        }
+    }
+    return cata_variant();
+}
+
+const event::data_type &event::data() const
+{
+    if( !data_ ) {
+        data_.emplace();
+        for( size_t i = 0; i < num_fields_; ++i ) {
+            data_->emplace( fields_[i].first, to_variant( payload_[i] ) );
+        }
+    }
+    return *data_;
+}
+
+std::array<size_t, event_detail::max_event_fields> event::sorted_fields() const
+{
+    std::array<size_t, event_detail::max_event_fields> order;
+    std::iota( order.begin(), order.begin() + num_fields_, 0 );
+    std::sort( order.begin(), order.begin() + num_fields_, [this]( size_t l, size_t r ) {
+        return std::string_view( fields_[l].first ) < std::string_view( fields_[r].first );
+    } );
+    return order;
+}
+
+size_t event::hash() const
+{
+    if( fields_ == nullptr ) {
+        return data_hash( data() );
+    }
+    size_t seed = num_fields_;
+    const std::array<size_t, event_detail::max_event_fields> order = sorted_fields();
+    std::string buffer;
+    for( size_t i = 0; i < num_fields_; ++i ) {
+        const event_detail::field_value &value = payload_[order[i]];
+        hash_field( seed, fields_[order[i]].first, static_cast<cata_variant_type>( value.index() ),
+                    to_string_view( value, buffer ) );
+    }
+    return seed;
+}
+
+size_t event::data_hash( const data_type &data )
+{
+    size_t seed = data.size();
+    for( const std::pair<const std::string, cata_variant> &field : data ) {
+        hash_field( seed, field.first, field.second.type(), field.second.get_string() );
+    }
+    return seed;
+}
+
+bool event::data_equals( const data_type &data ) const
+{
+    if( fields_ == nullptr ) {
+        return this->data() == data;
+    }
+    if( data.size() != num_fields_ ) {
+        return false;
+    }
+    const std::array<size_t, event_detail::max_event_fields> order = sorted_fields();
+    std::string buffer;
+    size_t i = 0;
+    for( const std::pair<const std::string, cata_variant> &field : data ) {
+        const event_detail::field_value &value = payload_[order[i]];
+        if( field.first != fields_[order[i]].first ||
+            field.second.type() != static_cast<cata_variant_type>( value.index() ) ||
+            field.second.get_string() != to_string_view( value, buffer ) ) {
+            return false;
+        }
+        ++i;
     }
-    return it->second;
+    return true;
 }
 
 } // namespace cata
@@ -5,14 +5,17 @@
 #include <array>
 #include <cstddef>
 #include <map>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "calendar.h"
 #include "cata_variant.h"
+#include "int_id.h"
 
 template <typename E> struct enum_traits;
 
@@ -979,6 +982,29 @@ struct event_spec<event_type::vehicle_moves> {
     };
 };
 
+// The most fields any event_spec has, see vehicle_moves.
+constexpr size_t max_event_fields = 11;
+
+// The value of one event field, kept as its own type rather than as the string a
+// cata_variant holds.  Ids and numbers stored this way don't allocate.  The index
+// of the held alternative is the field's cata_variant_type.
+template<cata_variant_type Type>
+using field_value_t = std::conditional_t < Type == cata_variant_type::void_, std::monostate,
+      typename cata_variant_detail::convert<Type>::type >;
+
+template<size_t... I>
+std::variant<field_value_t<static_cast<cata_variant_type>( I )>...> field_value_variant(
+    std::index_sequence<I...> );
+
+using field_value = decltype( field_value_variant(
+                                  std::make_index_sequence<static_cast<size_t>( cata_variant_type::num_types )>() ) );
+
+template<cata_variant_type Type>
+field_value make_field_value( const field_value_t<Type> &value )
+{
+    return field_value( std::in_place_index<static_cast<size_t>( Type )>, value );
+}
+
 template<event_type Type, typename IndexSequence>
 struct make_event_helper;
 
@@ -988,12 +1014,23 @@ class event
 {
     public:
         using data_type = std::map<std::string, cata_variant>;
+        // The values of an event in the order of its event_spec fields.  Sized
+        // for the largest event_spec so that making an event does not allocate.
+        using payload_type = std::array<event_detail::field_value, event_detail::max_event_fields>;
 
         event( event_type type, time_point time, data_type &&data )
             : type_( type )
             , time_( time )
             , data_( std::move( data ) )
         {}
+        event( event_type type, time_point time, const event_detail::event_field *fields,
+               size_t num_fields, payload_type &&payload )
+            : type_( type )
+            , time_( time )
+            , fields_( fields )
+            , num_fields_( num_fields )
+            , payload_( std::move( payload ) )
+        {}
         event() : type_( event_type::num_event_types ) {}
 
         // Call this to construct an event in a type-safe manner.  It will
@@ -1008,6 +1045,8 @@ class event
                            "spec for this event type must be defined and empty" );
             static_assert( sizeof...( Args ) == Spec::fields.size(),
                            "wrong number of arguments for event type" );
+            static_assert( sizeof...( Args ) <= event_detail::max_event_fields,
+                           "max_event_fields must cover the largest event_spec" );
 
             return event_detail::make_event_helper <
                    Type, std::make_index_sequence<sizeof...( Args )>
@@ -1032,22 +1071,43 @@ class event
         cata_variant get_variant_or_void( const std::string &key ) const;
 
         template<cata_variant_type Type>
-        auto get( const std::string &key ) const {
+        auto get( const std::string &key ) const -> typename cata_variant_detail::convert<Type>::type {
+            const event_detail::field_value *value = find_field( key );
+            if( value != nullptr && value->index() == static_cast<size_t>( Type ) ) {
+                return std::get<static_cast<size_t>( Type )>( *value );
+            }
             return get_variant( key ).get<Type>();
         }
 
         template<typename T>
         auto get( const std::string &key ) const {
-            return get_variant( key ).get<T>();
+            return get<cata_variant_type_for<T>()>( key );
         }
 
-        const data_type &data() const {
-            return data_;
-        }
+        // The payload as a map.  Events made from their event_spec only build
+        // this on first use, so prefer get() where a single field will do.
+        const data_type &data() const;
+
+        // Hash of the payload, equal to data_hash( data() ) but computed without
+        // building the map.
+        size_t hash() const;
+        // Whether data equals data() without building the map.
+        bool data_equals( const data_type &data ) const;
+        static size_t data_hash( const data_type &data );
     private:
+        // The payload value for key, or null if there is no payload or no such field.
+        const event_detail::field_value *find_field( const std::string &key ) const;
+        // Indices into fields_ ordered by key, as they are in a data_type.
+        std::array<size_t, event_detail::max_event_fields> sorted_fields() const;
+
         event_type type_;
         time_point time_;
-        data_type data_;
+        // The event_spec fields describing payload_, or null when the values
+        // were given as a map.
+        const event_detail::event_field *fields_ = nullptr;
+        size_t num_fields_ = 0;
+        payload_type payload_;
+        mutable std::optional<data_type> data_;
 };
 
 namespace event_detail
@@ -1059,13 +1119,10 @@ struct make_event_helper<Type, std::index_sequence<I...>> {
 
     template<typename... Args>
     event operator()( time_point time, Args &&... args ) {
-        return event(
-                   Type,
-                   time,
-        std::map<std::string, cata_variant> { {
-                Spec::fields[I].first,
-                cata_variant::make<Spec::fields[I].second>( args )
-            } ...
+        return event( Type, time, Spec::fields.data(), Spec::fields.size(),
+        event::payload_type{ {
+                make_field_value<Spec::fields[I].second>( args )...
+            }
         } );
     }
 };
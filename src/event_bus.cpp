@@ -121,6 +121,7 @@ struct make_dyn_helper<Type, std::index_sequence<I...>> {
     using Spec = cata::event_detail::event_spec<Type>;
 
     cata::event operator()( time_point time, std::vector<std::string> &args ) {
+        // Kept as strings, the arguments are only checked when something reads them.
         return cata::event(
                    Type,
                    time,
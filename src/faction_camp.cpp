@@ -224,6 +224,8 @@ static const update_mapgen_id update_mapgen_faction_wall_level_W_1( "faction_wal
 static const zone_type_id zone_type_CAMP_FOOD( "CAMP_FOOD" );
 static const zone_type_id zone_type_CAMP_STORAGE( "CAMP_STORAGE" );
 
+static const oter_matcher oter_match_faction_base_contains( "faction_base", ot_match_type::contains );
+
 static const std::string faction_wall_level_n_0_string = "faction_wall_level_N_0";
 static const std::string faction_wall_level_n_1_string = "faction_wall_level_N_1";
 
@@ -738,7 +740,7 @@ void talk_function::start_camp( npc &p )
 
     for( const auto &om_near : om_building_region( omt_pos, 3 ) ) {
         const oter_id &om_type = oter_id( om_near.first );
-        if( is_ot_match( "faction_base", om_type, ot_match_type::contains ) ||
+        if( oter_match_faction_base_contains.matches( om_type ) ||
             overmap_buffer.has_camp( om_near.second ) ) {
             popup( _( "You are too close to another camp!" ) );
             return;
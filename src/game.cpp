@@ -761,9 +761,9 @@ void game::legacy_migrate_npctalk_var_prefix( global_variables::impl_t &map_of_v
 
     const std::string prefix = "npctalk_var_";
     for( auto i = map_of_vars.begin(); i != map_of_vars.end(); ) {
-        if( i->first.rfind( prefix, 0 ) == 0 ) {
+        if( i->first.str().rfind( prefix, 0 ) == 0 ) {
             auto extracted =  map_of_vars.extract( i++ );
-            std::string new_key = extracted.key().substr( prefix.size() );
+            std::string new_key = extracted.key().str().substr( prefix.size() );
             extracted.key() = new_key;
             map_of_vars.insert( std::move( extracted ) );
         } else {
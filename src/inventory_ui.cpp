@@ -103,10 +103,10 @@ void debug_print_timer( startup_timer const &tp, std::string const &msg = "inv_u
     add_msg_debug( debugmode::DF_GAME, "%s: %i ms", msg, ( tp_now - tp ).count() );
 }
 
-// using item_name_t = std::pair<std::string, std::string>;
+// Names are only used for sorting, so they are stored as collation keys right away.
 struct item_name_t {
-    std::string sort_key;
-    std::string full_name;
+    localized_sort_key sort_key;
+    localized_sort_key full_name;
     unsigned int contents_count{};
 };
 using name_cache_t = std::unordered_map<item const *, item_name_t>;
@@ -118,8 +118,8 @@ item_name_t &get_cached_name( item const *it )
     auto iter = item_name_cache.find( it );
     if( iter == item_name_cache.end() ) {
         return item_name_cache
-               .emplace( it, item_name_t{ remove_color_tags( it->tname( 1, tname::tname_sort_key ) ),
-                                          remove_color_tags( it->tname( 1, tname::unprefixed_tname, true ) ),
+               .emplace( it, item_name_t{ localized_sort_key( remove_color_tags( it->tname( 1, tname::tname_sort_key ) ) ),
+                                          localized_sort_key( remove_color_tags( it->tname( 1, tname::unprefixed_tname, true ) ) ),
                                           it->aggregated_contents().count } )
                .first->second;
     }
@@ -754,8 +754,9 @@ bool inventory_selector_preset::sort_compare( const inventory_entry &lhs,
         const inventory_entry &rhs ) const
 {
     auto const sort_key = []( inventory_entry const & e ) {
-        return std::make_tuple( *e.cached_name, e.contents_count, *e.cached_name_full,
-                                e.any_item()->link_sort_key(), e.generation );
+        return std::tuple<const localized_sort_key &, unsigned int, const localized_sort_key &, int, size_t>(
+                   *e.cached_name, e.contents_count, *e.cached_name_full,
+                   e.any_item()->link_sort_key(), e.generation );
     };
     return localized_compare( sort_key( lhs ), sort_key( rhs ) );
 }
@@ -42,6 +42,7 @@ class JsonOut;
 class basecamp;
 class inventory_selector_preset;
 class item_stack;
+class localized_sort_key;
 class string_input_popup;
 class tinymap;
 class ui_adaptor;
@@ -81,8 +82,8 @@ class inventory_entry
 
         size_t chosen_count = 0;
         int custom_invlet = INT_MIN;
-        std::string *cached_name = nullptr;
-        std::string *cached_name_full = nullptr;
+        const localized_sort_key *cached_name = nullptr;
+        const localized_sort_key *cached_name_full = nullptr;
         unsigned int contents_count = 0;
         size_t cached_denial_space = 0;
 
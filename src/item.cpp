@@ -85,6 +85,7 @@
 #include "trap.h"
 #include "units.h"
 #include "value_ptr.h"
+#include "var_key.h"
 #include "vitamin.h"
 #include "vpart_position.h"
 #include "weather.h"
@@ -145,6 +146,13 @@ static const std::string flag_NO_SELL( "NO_SELL" );
 // fault flags
 static const std::string flag_BLACKPOWDER_FOULING_DAMAGE( "BLACKPOWDER_FOULING_DAMAGE" );
 
+static const var_key var_activity_var( "activity_var" );
+static const var_key var_dirt( "dirt" );
+static const var_key var_gun_heat( "gun_heat" );
+static const var_key var_integral_weight( "integral_weight" );
+static const var_key var_volume( "volume" );
+static const var_key var_weight( "weight" );
+
 // item pricing
 static const int PRICE_FILTHY_MALUS = 100;  // cents
 
@@ -892,7 +900,7 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     const bool both_empty_vars = item_vars.empty() && rhs.item_vars.empty();
     bits.set( tname::segments::ACTIVITY_OCCUPANCY,
               both_empty_vars ||
-              get_var( "activity_var", "" ) == rhs.get_var( "activity_var", "" ) );
+              get_var( var_activity_var, "" ) == rhs.get_var( var_activity_var, "" ) );
     bits.set( tname::segments::FILTHY, is_filthy() == rhs.is_filthy() );
     bits.set( tname::segments::WETNESS, _stacks_wetness( *this, rhs, precise ) );
     bits.set( tname::segments::WEAPON_MODS, _stacks_weapon_mods( *this, rhs ) );
@@ -915,7 +923,7 @@ stacking_info item::stacks_with( const item &rhs, bool check_components, bool co
     bits.set( tname::segments::TECHNIQUES, techniques == rhs.techniques );
     bits.set( tname::segments::OVERHEAT, overheat_symbol() == rhs.overheat_symbol() );
     bits.set( tname::segments::DIRT,
-              both_empty_vars || get_var( "dirt", 0 ) == rhs.get_var( "dirt", 0 ) );
+              both_empty_vars || get_var( var_dirt, 0 ) == rhs.get_var( var_dirt, 0 ) );
     bits.set( tname::segments::SEALED, all_pockets_sealed() == rhs.all_pockets_sealed() );
     bits.set( tname::segments::CBM_STATUS, _stacks_cbm_status( *this, rhs ) );
     bits.set( tname::segments::BROKEN, is_broken() == rhs.is_broken() );
@@ -1006,12 +1014,12 @@ bool item::merge_charges( const item &rhs )
     return true;
 }
 
-void item::set_var( const std::string &key, diag_value value )
+void item::set_var( const var_key &key, diag_value value )
 {
     item_vars[ key ] = std::move( value );
 }
 
-double item::get_var( std::string_view key, double default_value ) const
+double item::get_var( var_key_view key, double default_value ) const
 {
     if( item_vars.empty() ) {
         return default_value;
@@ -1023,7 +1031,7 @@ double item::get_var( std::string_view key, double default_value ) const
     return default_value;
 }
 
-std::string item::get_var( std::string_view key, std::string default_value ) const
+std::string item::get_var( var_key_view key, std::string default_value ) const
 {
     if( item_vars.empty() ) {
         return default_value;
@@ -1035,7 +1043,7 @@ std::string item::get_var( std::string_view key, std::string default_value ) con
     return default_value;
 }
 
-tripoint_abs_ms item::get_var( std::string_view key, tripoint_abs_ms default_value ) const
+tripoint_abs_ms item::get_var( var_key_view key, tripoint_abs_ms default_value ) const
 {
     if( item_vars.empty() ) {
         return default_value;
@@ -1047,37 +1055,37 @@ tripoint_abs_ms item::get_var( std::string_view key, tripoint_abs_ms default_val
     return default_value;
 }
 
-void item::remove_var( const std::string &key )
+void item::remove_var( var_key_view key )
 {
-    item_vars.erase( key );
+    global_variables::_common_remove_value( key, item_vars );
 }
 
-diag_value const &item::get_value( std::string_view name ) const
+diag_value const &item::get_value( var_key_view name ) const
 {
     static diag_value const null_val;
     if( item_vars.empty() ) {
         return null_val;
     }
-    return global_variables::_common_get_value( std::string( name ), item_vars );
+    return global_variables::_common_get_value( name, item_vars );
 
 }
 
-diag_value const *item::maybe_get_value( std::string_view name ) const
+diag_value const *item::maybe_get_value( var_key_view name ) const
 {
     if( item_vars.empty() ) {
         return nullptr;
     }
-    return global_variables::_common_maybe_get_value( std::string( name ), item_vars );
+    return global_variables::_common_maybe_get_value( name, item_vars );
 }
 
-bool item::has_var( std::string_view name ) const
+bool item::has_var( var_key_view name ) const
 {
-    return !item_vars.empty() && item_vars.count( std::string( name ) ) > 0;
+    return maybe_get_value( name ) != nullptr;
 }
 
-void item::erase_var( const std::string &name )
+void item::erase_var( var_key_view name )
 {
-    item_vars.erase( name );
+    global_variables::_common_remove_value( name, item_vars );
 }
 
 void item::clear_vars()
@@ -2018,7 +2026,7 @@ units::mass item::weight( bool include_contents, bool integral ) const
 
     units::mass ret;
     double ret_mul = 1.0;
-    diag_value const &local_mass = get_value( integral ? "integral_weight" : "weight" );
+    diag_value const &local_mass = get_value( integral ? var_integral_weight : var_weight );
     if( local_mass.is_empty() ) {
         ret = integral ? type->integral_weight : type->weight;
     } else {
@@ -2168,7 +2176,7 @@ units::volume item::collapsed_volume_delta() const
     if( is_gun() && ( has_flag( flag_COLLAPSIBLE_STOCK ) || has_flag( flag_COLLAPSED_STOCK ) ||
                       has_flag( flag_REMOVED_STOCK ) ) ) {
         // consider only the base size of the gun (without mods)
-        int tmpvol = get_var( "volume",
+        int tmpvol = get_var( var_volume,
                               ( type->volume - type->gun->barrel_volume ) / 250_ml );
         if( tmpvol <= 3 ) {
             // intentional NOP
@@ -2271,7 +2279,7 @@ units::volume item::volume( bool integral, bool ignore_contents, int charges_in_
         return *craft_data_->cached_volume;
     }
 
-    const int local_volume = get_var( "volume", -1 );
+    const int local_volume = get_var( var_volume, -1 );
     units::volume ret;
     if( local_volume >= 0 ) {
         ret = local_volume * 250_ml;
@@ -4185,7 +4193,7 @@ int item::processing_speed() const
 
     if( active || ethereal || wetness || has_link_data() ||
         has_flag( flag_RADIO_ACTIVATION ) || has_relic_recharge() ||
-        has_fault_flag( flag_BLACKPOWDER_FOULING_DAMAGE ) || get_var( "gun_heat", 0 ) > 0 ||
+        has_fault_flag( flag_BLACKPOWDER_FOULING_DAMAGE ) || get_var( var_gun_heat, 0 ) > 0 ||
         has_fault( fault_emp_reboot ) ) {
         // Unless otherwise indicated, update every turn.
         return 1;
@@ -4875,7 +4883,7 @@ bool item::process_internal( map &here, Character *carrier, const tripoint_bub_m
         if( has_fault_flag( flag_BLACKPOWDER_FOULING_DAMAGE ) ) {
             return process_blackpowder_fouling( carrier );
         }
-        if( get_var( "gun_heat", 0 ) > 0 ) {
+        if( get_var( var_gun_heat, 0 ) > 0 ) {
             return process_gun_cooling( carrier );
         }
         if( has_fault( fault_emp_reboot ) ) {
@@ -2071,23 +2071,23 @@ class item : public visitable
          * already used somewhere.
          */
         /*@{*/
-        double get_var( std::string_view key, double default_value ) const;
-        std::string get_var( std::string_view key, std::string default_value = {} ) const;
-        tripoint_abs_ms get_var( std::string_view key, tripoint_abs_ms default_value ) const;
+        double get_var( var_key_view key, double default_value ) const;
+        std::string get_var( var_key_view key, std::string default_value = {} ) const;
+        tripoint_abs_ms get_var( var_key_view key, tripoint_abs_ms default_value ) const;
 
-        void set_var( const std::string &key, diag_value value );
+        void set_var( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_var( const std::string &key, Args... args ) {
+        void set_var( const var_key &key, Args... args ) {
             set_var( key, diag_value{ std::forward<Args>( args )... } );
         }
 
-        void remove_var( const std::string &key );
-        diag_value const &get_value( std::string_view name ) const;
-        diag_value const *maybe_get_value( std::string_view name ) const;
+        void remove_var( var_key_view key );
+        diag_value const &get_value( var_key_view name ) const;
+        diag_value const *maybe_get_value( var_key_view name ) const;
         /** Whether the variable is defined at all. */
-        bool has_var( std::string_view name ) const;
+        bool has_var( var_key_view name ) const;
         /** Erase the value of the given variable. */
-        void erase_var( const std::string &name );
+        void erase_var( var_key_view name );
         /** Removes all item variables. */
         void clear_vars();
         /*@}*/
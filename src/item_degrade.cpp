@@ -56,6 +56,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "value_ptr.h"
+#include "var_key.h"
 #include "visitable.h"
 #include "weather.h"
 #include "weather_gen.h"
@@ -64,6 +65,8 @@
 static const item_category_id item_category_drugs( "drugs" );
 static const item_category_id item_category_food( "food" );
 
+static const var_key var_ENERGY_SHIELD_HP( "ENERGY_SHIELD_HP" );
+
 namespace item_internal
 {
 static bool goes_bad_temp_cache = false;
@@ -902,10 +905,10 @@ item::armor_status item::damage_armor_durability( damage_unit &du, damage_unit &
 {
     //Energy shields aren't damaged by attacks but do get their health variable reduced.  They are also only
     //damaged by the damage types they actually protect against.
-    if( has_var( "ENERGY_SHIELD_HP" ) && resist( du.type, false, bp ) > 0.0f ) {
-        double shield_hp = get_var( "ENERGY_SHIELD_HP", 0.0 );
+    if( has_var( var_ENERGY_SHIELD_HP ) && resist( du.type, false, bp ) > 0.0f ) {
+        double shield_hp = get_var( var_ENERGY_SHIELD_HP, 0.0 );
         shield_hp -= premitigated.amount;
-        set_var( "ENERGY_SHIELD_HP", shield_hp );
+        set_var( var_ENERGY_SHIELD_HP, shield_hp );
         if( shield_hp > 0 ) {
             return armor_status::UNDAMAGED;
         } else {
@@ -76,6 +76,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "value_ptr.h"
+#include "var_key.h"
 #include "veh_type.h"
 #include "vehicle.h"
 #include "vpart_position.h"
@@ -120,6 +121,12 @@ static const mtype_id pseudo_debug_mon( "pseudo_debug_mon" );
 
 static const skill_id skill_archery( "archery" );
 
+static const var_key var_cable( "cable" );
+static const var_key var_dirt( "dirt" );
+static const var_key var_gun_heat( "gun_heat" );
+static const var_key var_rust_timer( "rust_timer" );
+static const var_key var_volume( "volume" );
+
 static constexpr float MIN_LINK_EFFICIENCY = 0.001f;
 
 item &null_item_reference()
@@ -617,7 +624,7 @@ int item::on_wield_cost( const Character &you ) const
             d /= std::max( you.get_skill_level( melee_skill() ), 1.0f );
         }
 
-        int penalty = get_var( "volume", volume() / 250_ml ) * d;
+        int penalty = get_var( var_volume, volume() / 250_ml ) * d;
         // arbitrary no more than 7 second of penalty
         mv += std::min( penalty, 700 );
     }
@@ -666,7 +673,7 @@ std::string item::dirt_symbol() const
     // these symbols are unicode square characters of different heights, representing a rough
     // estimation of fouling in a gun. This appears instead of "faulty" since most guns will
     // have some level of fouling in them, and usually it is not a big deal.
-    switch( static_cast<int>( get_var( "dirt", 0 ) / 2000 ) ) {
+    switch( static_cast<int>( get_var( var_dirt, 0 ) / 2000 ) ) {
         // *INDENT-OFF*
         case 1:  return "<color_white>\u2581</color>";
         case 2:  return "<color_light_gray>\u2583</color>";
@@ -693,7 +700,7 @@ std::string item::overheat_symbol() const
     if( has_fault( fault_overheat_safety ) ) {
         return string_format( _( "<color_light_green>\u2588VNT </color>" ) );
     }
-    switch( std::min( 5, static_cast<int>( get_var( "gun_heat",
+    switch( std::min( 5, static_cast<int>( get_var( var_gun_heat,
                                            0 ) / std::max( type->gun->overheat_threshold * multiplier + modifier, 5.0 ) * 5.0 ) ) ) {
         case 1:
             return "";
@@ -3922,7 +3929,7 @@ bool item::process_link( map &here, Character *carrier, const tripoint_bub_ms &p
         }
     }
     const item_filter used_ups = [&]( const item & itm ) {
-        return itm.get_var( "cable" ) == "plugged_in";
+        return itm.get_var( var_cable ) == "plugged_in";
     };
     if( link().source == link_state::ups ) {
         if( carrier == nullptr || !carrier->cache_has_item_with( flag_IS_UPS, used_ups ) ) {
@@ -4290,7 +4297,7 @@ bool item::process_linked_item( Character *carrier, const tripoint_bub_ms & /*po
                                 const link_state required_state )
 {
     if( carrier == nullptr ) {
-        erase_var( "cable" );
+        erase_var( var_cable );
         active = false;
         return false;
     }
@@ -4299,7 +4306,7 @@ bool item::process_linked_item( Character *carrier, const tripoint_bub_ms & /*po
         return it.link_has_state( required_state );
     } );
     if( !has_connected_cable ) {
-        erase_var( "cable" );
+        erase_var( var_cable );
         active = false;
     }
     return false;
@@ -4398,13 +4405,13 @@ bool item::process_blackpowder_fouling( Character *carrier )
 {
     // Rust is deterministic. At a total modifier of 1 (the max): 12 hours for first rust, then 24 (36 total), then 36 (72 total) and finally 48 (120 hours to go to XX)
     // this speeds up by the amount the gun is dirty, 2-6x as fast depending on dirt level. At minimum dirt, the modifier is 0.3x the speed of the above mentioned figures.
-    set_var( "rust_timer", get_var( "rust_timer", 0 ) + std::min( 0.3 + get_var( "dirt", 0 ) / 200,
-             1.0 ) );
+    set_var( var_rust_timer, get_var( var_rust_timer, 0 ) +
+             std::min( 0.3 + get_var( var_dirt, 0 ) / 200, 1.0 ) );
     double time_mult = 1.0 + ( 4.0 * static_cast<double>( damage() ) ) / static_cast<double>
                        ( max_damage() );
-    if( damage() < max_damage() && get_var( "rust_timer", 0 ) > 43200.0 * time_mult ) {
+    if( damage() < max_damage() && get_var( var_rust_timer, 0 ) > 43200.0 * time_mult ) {
         inc_damage();
-        set_var( "rust_timer", 0 );
+        set_var( var_rust_timer, 0 );
         if( carrier ) {
             carrier->add_msg_if_player( m_bad, _( "Your %s rusts due to corrosive powder fouling." ), tname() );
         }
@@ -4414,7 +4421,7 @@ bool item::process_blackpowder_fouling( Character *carrier )
 
 bool item::process_gun_cooling( Character *carrier )
 {
-    double heat = get_var( "gun_heat", 0 );
+    double heat = get_var( var_gun_heat, 0 );
     double overheat_modifier = 0;
     float overheat_multiplier = 1.0f;
     double cooling_modifier = 0;
@@ -4428,7 +4435,7 @@ bool item::process_gun_cooling( Character *carrier )
     double threshold = std::max( ( type->gun->overheat_threshold * overheat_multiplier ) +
                                  overheat_modifier, 5.0 );
     heat -= std::max( ( type->gun->cooling_value * cooling_multiplier ) + cooling_modifier, 0.5 );
-    set_var( "gun_heat", std::max( 0.0, heat ) );
+    set_var( var_gun_heat, std::max( 0.0, heat ) );
     if( has_fault( fault_overheat_safety ) && heat < threshold * 0.2 ) {
         remove_fault( fault_overheat_safety );
         if( carrier ) {
@@ -43,6 +43,7 @@
 #include "type_id.h"
 #include "units.h"
 #include "value_ptr.h"
+#include "var_key.h"
 
 static const flag_id json_flag_HINT_THE_LOCATION( "HINT_THE_LOCATION" );
 static const flag_id json_flag_LOCATION_PRECISE_CLOSEST_CITY( "LOCATION_PRECISE_CLOSEST_CITY" );
@@ -52,6 +53,15 @@ static const itype_id itype_disassembly( "disassembly" );
 
 static const skill_id skill_survival( "survival" );
 
+static const var_key var_NANOFAB_ITEM_ID( "NANOFAB_ITEM_ID" );
+static const var_key var_activity_var( "activity_var" );
+static const var_key var_cable( "cable" );
+static const var_key var_ethereal( "ethereal" );
+static const var_key var_local_files_simple_snippet_id( "local_files_simple_snippet_id" );
+static const var_key var_map_cache( "map_cache" );
+static const var_key var_snippet_file( "snippet_file" );
+static const var_key var_spawn_location( "spawn_location" );
+
 using segment_bitset = tname::segment_bitset;
 
 namespace
@@ -357,9 +367,9 @@ std::string food_traits( item const &it, unsigned int /* quantity */,
 std::string location_hint( item const &it, unsigned int /* quantity */,
                            segment_bitset const &/* segments */ )
 {
-    if( it.has_flag( json_flag_HINT_THE_LOCATION ) && it.has_var( "spawn_location" ) ) {
+    if( it.has_flag( json_flag_HINT_THE_LOCATION ) && it.has_var( var_spawn_location ) ) {
         tripoint_abs_omt loc( coords::project_to<coords::omt>(
-                                  it.get_var( "spawn_location", tripoint_abs_ms::zero ) ) );
+                                  it.get_var( var_spawn_location, tripoint_abs_ms::zero ) ) );
         tripoint_abs_omt player_loc( coords::project_to<coords::omt>(
                                          get_avatar().pos_abs() ) );
         int dist = rl_dist( player_loc, loc );
@@ -379,7 +389,8 @@ std::string location_closest_city( item const &it, unsigned int /* quantity */,
                                    segment_bitset const &/* segments */ )
 {
     if( it.has_flag( json_flag_LOCATION_PRECISE_CLOSEST_CITY ) ) {
-        const tripoint_abs_ms map_pos_ms = it.get_var( "spawn_location", tripoint_abs_ms::invalid );
+        const tripoint_abs_ms map_pos_ms = it.get_var( var_spawn_location,
+                                           tripoint_abs_ms::invalid );
         city_reference closest_city = city_reference::invalid;
         if( !map_pos_ms.is_invalid() ) {
             const tripoint_abs_omt map_pos_omt = project_to<coords::omt>( map_pos_ms );
@@ -398,7 +409,7 @@ std::string ethereal( item const &it, unsigned int /* quantity */,
 {
     if( it.ethereal ) {
         const time_duration turns = time_duration::from_turns(
-                                        std::lround( it.get_var( "ethereal", 0.0 ) ) );
+                                        std::lround( it.get_var( var_ethereal, 0.0 ) ) );
         return string_format( _( " (%s)" ), to_string( turns, true ) );
     }
     return {};
@@ -514,20 +525,22 @@ std::string vars( item const &it, unsigned int /* quantity */,
                   segment_bitset const &/* segments */ )
 {
     std::string ret;
-    if( it.has_var( "NANOFAB_ITEM_ID" ) ) {
+    if( it.has_var( var_NANOFAB_ITEM_ID ) ) {
         if( it.has_flag( flag_NANOFAB_TEMPLATE_SINGLE_USE ) ) {
             //~ Single-use descriptor for nanofab templates. %s = name of resulting item. The leading space is intentional.
             ret += string_format( _( " (SINGLE USE %s)" ),
-                                  item::nname( itype_id( it.get_var( "NANOFAB_ITEM_ID" ) ) ) );
+                                  item::nname( itype_id( it.get_var( var_NANOFAB_ITEM_ID ) ) ) );
         }
-        ret += string_format( " (%s)", item::nname( itype_id( it.get_var( "NANOFAB_ITEM_ID" ) ) ) );
+        ret += string_format( " (%s)",
+                              item::nname( itype_id( it.get_var( var_NANOFAB_ITEM_ID ) ) ) );
     }
 
-    if( it.has_var( "snippet_file" ) ) {
-        std::string has_snippet = it.get_var( "snippet_file" );
+    if( it.has_var( var_snippet_file ) ) {
+        std::string has_snippet = it.get_var( var_snippet_file );
         if( has_snippet == "has" ) {
             std::optional<translation> snippet_name =
-                SNIPPET.get_name_by_id( snippet_id( it.get_var( "local_files_simple_snippet_id" ) ) );
+                SNIPPET.get_name_by_id( snippet_id(
+                                            it.get_var( var_local_files_simple_snippet_id ) ) );
             if( snippet_name ) {
                 ret += string_format( " (%s)", snippet_name->translated() );
             }
@@ -536,8 +549,8 @@ std::string vars( item const &it, unsigned int /* quantity */,
         }
     }
 
-    if( it.has_var( "map_cache" ) ) {
-        std::string has_map_cache = it.get_var( "map_cache" );
+    if( it.has_var( var_map_cache ) ) {
+        std::string has_map_cache = it.get_var( var_map_cache );
         if( has_map_cache == "read" ) {
             ret += _( " (read)" );
         }
@@ -546,7 +559,7 @@ std::string vars( item const &it, unsigned int /* quantity */,
     if( it.already_used_by_player( get_avatar() ) ) {
         ret += _( " (used)" );
     }
-    if( it.has_flag( flag_IS_UPS ) && it.get_var( "cable" ) == "plugged_in" ) {
+    if( it.has_flag( flag_IS_UPS ) && it.get_var( var_cable ) == "plugged_in" ) {
         ret += _( " (plugged in)" );
     }
     return ret;
@@ -623,7 +636,7 @@ std::string active( item const &it, unsigned int /* quantity */,
 std::string activity_occupany( item const &it, unsigned int /* quantity */,
                                segment_bitset const &/* segments */ )
 {
-    if( it.has_var( "activity_var" ) ) {
+    if( it.has_var( var_activity_var ) ) {
         // Usually the items whose ids end in "_on" have the "active" or "on" string already contained
         // in their name, also food is active while it rots.
         return _( " (in use)" );
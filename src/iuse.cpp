@@ -410,6 +410,8 @@ static const vitamin_id vitamin_redcells( "redcells" );
 
 static const weather_type_id weather_portal_storm( "portal_storm" );
 
+static const oter_matcher oter_match_river_contains( "river_", ot_match_type::contains );
+
 // how many characters per turn of radio
 static constexpr int RADIO_PER_TURN = 25;
 
@@ -1742,7 +1744,7 @@ static bool good_fishing_spot( const tripoint_bub_ms &pos, Character *p )
         // this is a ridiculous way to find a good fishing spot, but I'm just trying
         // to do oceans right now.  Maybe is_water_body() would be better?
         // if you find this comment still here and it's later than 2025, LOL.
-        is_ot_match( "river_", cur_omt, ot_match_type::contains ) &&
+        oter_match_river_contains.matches( cur_omt ) &&
         !cur_omt->is_lake() && !cur_omt->is_ocean() &&
         !cur_omt->is_lake_shore() && !cur_omt->is_ocean_shore() ) {
         p->add_msg_if_player( m_info, _( "You doubt you will have much luck catching fish here." ) );
@@ -53,3 +53,29 @@ bool localized_comparator::operator()( const translation &l, const translation &
 {
     return l.translated_lt( r );
 }
+
+localized_sort_key::localized_sort_key( const std::string &str )
+{
+    // See localized_comparator::operator() above for the platform differences.
+    // MacOS has no way to transform a string into a collation key in the
+    // standard library, so there the original string gets compared instead.
+#if defined(__APPLE__)
+    key = str;
+#elif defined(_WIN32)
+    const std::wstring wide = utf8_to_wide_string( str );
+    key = std::use_facet<std::collate<wchar_t>>( std::locale() ).transform(
+              wide.data(), wide.data() + wide.size() );
+#else
+    key = std::use_facet<std::collate<char>>( std::locale() ).transform(
+              str.data(), str.data() + str.size() );
+#endif
+}
+
+bool localized_sort_key::operator<( const localized_sort_key &rhs ) const
+{
+#if defined(__APPLE__)
+    return localized_compare( key, rhs.key );
+#else
+    return key < rhs.key;
+#endif
+}
@@ -2,8 +2,32 @@
 #ifndef CATA_SRC_LOCALIZED_COMPARATOR_H
 #define CATA_SRC_LOCALIZED_COMPARATOR_H
 
+#include <string>
+
 #include "translation.h"
 
+// Precomputed key for sorting a string according to the user's locale.
+//
+// Comparing two keys gives the same order as localized_comparator gives for
+// the original strings, but doesn't go through the locale on every comparison,
+// so it's much cheaper when the same strings get compared over and over again,
+// e.g. when sorting long lists by name.  Keys must be rebuilt when the language
+// changes.
+class localized_sort_key
+{
+    public:
+        localized_sort_key() = default;
+        explicit localized_sort_key( const std::string &str );
+
+        bool operator<( const localized_sort_key &rhs ) const;
+    private:
+#if defined(_WIN32)
+        std::wstring key;
+#else
+        std::string key;
+#endif
+};
+
 // Localized comparison operator, intended for sorting strings when they should
 // be sorted according to the user's locale.
 //
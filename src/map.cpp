@@ -612,6 +612,9 @@ void map::add_vehicle_to_cache( vehicle *veh )
         return;
     }
 
+    // The vehicle was placed or moved, which may connect or cut cables.
+    g->power_networks().invalidate_topology();
+
     // Get parts
     for( const vpart_reference &vpr : veh->get_all_parts_with_fakes() ) {
         if( vpr.part().removed ) {
@@ -645,6 +648,7 @@ void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint_bub_ms &p
 
 void map::clear_vehicle_level_caches( )
 {
+    g->power_networks().invalidate_topology();
     for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
         level_cache *ch = get_cache_lazy( gridz );
         if( ch ) {
@@ -655,6 +659,7 @@ void map::clear_vehicle_level_caches( )
 
 void map::remove_vehicle_from_cache( vehicle *veh, int zmin, int zmax )
 {
+    g->power_networks().invalidate_topology();
     for( int gridz = zmin; gridz <= zmax; gridz++ ) {
         level_cache *const ch = get_cache_lazy( gridz );
         if( ch != nullptr ) {
@@ -701,6 +706,7 @@ void map::reset_vehicles_sm_pos()
 
 void map::clear_vehicle_list( const int zlev )
 {
+    g->power_networks().invalidate_topology();
     auto *ch = get_cache_lazy( zlev );
     if( ch ) {
         ch->vehicle_list.clear();
@@ -710,6 +716,7 @@ void map::clear_vehicle_list( const int zlev )
 
 void map::update_vehicle_list( const submap *const to, const int zlev )
 {
+    g->power_networks().invalidate_topology();
     // Update vehicle data
     level_cache &ch = get_cache( zlev );
     for( const auto &elem : to->vehicles ) {
@@ -816,7 +823,8 @@ void map::resolve_off_map_grid_generation()
         if( resolved.count( veh ) ) {
             continue;
         }
-        std::map<vehicle *, float> grid = veh->search_connected_vehicles( *this );
+        std::map<vehicle *, float> scratch;
+        const std::map<vehicle *, float> &grid = veh->connected_vehicles( *this, scratch );
         bool has_off_map_renewables = false;
         for( const auto &[grid_veh, loss] : grid ) {
             resolved.insert( grid_veh );
@@ -879,7 +887,8 @@ void map::resolve_appliance_grid_power()
                 continue;
             }
             // found a candidate -- resolve its entire grid
-            std::map<vehicle *, float> grid = veh->search_connected_vehicles( *this );
+            std::map<vehicle *, float> scratch;
+            const std::map<vehicle *, float> &grid = veh->connected_vehicles( *this, scratch );
             int total_charge = 0;
             for( const auto &[grid_veh, loss] : grid ) {
                 total_charge += grid_veh->battery_power_level().first;
@@ -9060,6 +9069,63 @@ bool generate_uniform_omt( const tripoint_abs_sm &p, const oter_id &terrain_type
     return ret;
 }
 
+// Whether all submaps of the overmap terrain stack at p exist in the map buffer.
+static bool omt_stack_generated( const tripoint_abs_omt &p )
+{
+    const tripoint_abs_sm sm_base = project_to<coords::sm>( p );
+    // It might be possible to just check the (0, 0) submap as we should never have
+    // a case where only one submap is missing from an OMT level.
+    for( int gridx = 0; gridx <= 1; gridx++ ) {
+        for( int gridy = 0; gridy <= 1; gridy++ ) {
+            for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
+                const tripoint grid_pos( gridx, gridy, gridz );
+                if( !MAPBUFFER.submap_exists( sm_base.xy() + grid_pos ) ) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool map::pregenerate_ahead( units::angle heading )
+{
+    // The overmap terrains in the first two rings outside the map that lie
+    // within 45 degrees of the heading, most aligned and nearest first.
+    const tripoint_abs_omt center = project_to<coords::omt>( abs_sub + tripoint( HALF_MAPSIZE,
+                                    HALF_MAPSIZE, 0 ) );
+    const int first_ring = HALF_MAPSIZE / 2 + 1;
+    // cos( 45 degrees )
+    constexpr double min_alignment = 0.70710678118654752;
+    const double dir_x = units::cos( heading );
+    const double dir_y = units::sin( heading );
+    std::vector<std::pair<double, tripoint_abs_omt>> candidates;
+    for( const tripoint_abs_omt &p : closest_points_first( center, first_ring, first_ring + 1 ) ) {
+        const point_rel_omt offset = p.xy() - center.xy();
+        const double alignment = ( offset.x() * dir_x + offset.y() * dir_y ) /
+                                 std::hypot( offset.x(), offset.y() );
+        if( alignment >= min_alignment ) {
+            candidates.emplace_back( alignment, p );
+        }
+    }
+    std::stable_sort( candidates.begin(), candidates.end(),
+    []( const std::pair<double, tripoint_abs_omt> &l, const std::pair<double, tripoint_abs_omt> &r ) {
+        return l.first > r.first;
+    } );
+
+    for( const std::pair<double, tripoint_abs_omt> &candidate : candidates ) {
+        if( omt_stack_generated( candidate.second ) ) {
+            continue;
+        }
+        smallmap tmp_map;
+        swap_map swap( *tmp_map.cast_to_map() );
+        tmp_map.main_cleanup_override( false );
+        tmp_map.generate( candidate.second, calendar::turn, true );
+        return true;
+    }
+    return false;
+}
+
 void map::loadn( const point_bub_sm &grid, bool update_vehicles )
 {
     dbg( D_INFO ) << "map::loadn(game[" << g.get() << "], worldx[" << abs_sub.x()
@@ -9069,26 +9135,13 @@ void map::loadn( const point_bub_sm &grid, bool update_vehicles )
     const tripoint_abs_omt grid_abs_omt = project_to<coords::omt>( grid_abs_sub );
     // Get the base submap "grid" is an offset from.
     const tripoint_abs_sm grid_sm_base = project_to<coords::sm>( grid_abs_omt );
-    bool map_incomplete = false;
 
     map &bubble_map = reality_bubble();
 
     bool const main_inbounds =
         this != &bubble_map && bubble_map.inbounds( project_to<coords::ms>( grid_abs_sub ) );
 
-    // It might be possible to just check the (0, 0) submap as we should never have
-    // a case where only one submap is missing from an OMT level.
-    for( int gridx = 0; !map_incomplete && gridx <= 1; gridx++ ) {
-        for( int gridy = 0; !map_incomplete && gridy <= 1; gridy++ ) {
-            for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
-                const tripoint grid_pos( gridx, gridy, gridz );
-                if( !MAPBUFFER.submap_exists( grid_sm_base.xy() + grid_pos ) ) {
-                    map_incomplete = true;
-                    break;
-                }
-            }
-        }
-    }
+    const bool map_incomplete = !omt_stack_generated( grid_abs_omt );
 
     if( map_incomplete ) {
         smallmap tmp_map;
@@ -1801,6 +1801,14 @@ class map
         // tripoint_abs_omt coordinate guarantees this will be fulfilled.
         void generate( const tripoint_abs_omt &p, const time_point &when, bool save_results,
                        bool run_post_process = true );
+        /**
+         * Run mapgen for at most one overmap terrain just outside the map, in the
+         * direction of @p heading, that hasn't been generated yet.  Called while
+         * travelling, this spreads the cost of mapgen over several turns instead of
+         * generating a whole row of overmap terrains at once when the map shifts.
+         * @returns true if mapgen was run.
+         */
+        bool pregenerate_ahead( units::angle heading );
         // Used when contents has been generated by 'generate' with save_results = false to dispose of
         // submaps that aren't present in the map buffer. This is done to avoid memory leaks.
         void delete_unmerged_submaps();
@@ -4,8 +4,10 @@
 #include <filesystem>
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
 #include <ostream>
+#include <set>
 #include <tuple>
 #include <utility>
 
@@ -31,6 +33,10 @@ const memorized_tile mm_submap::default_tile = {};
 
 static constexpr int MM_SIZE = MAPSIZE * 2;
 
+// Each tile of a submap may be distinct, palette indices are stored as 1 byte.
+static_assert( SEEX * SEEY <= std::numeric_limits<uint8_t>::max() + 1,
+               "mm_submap palette indices don't fit into uint8_t" );
+
 #define dbg(x) DebugLog((x),D_MMAP) << __FILE__ << ":" << __LINE__ << ": "
 
 // Moved from coordinate_conversions.h to the only file using it.
@@ -51,6 +57,24 @@ static std::string find_region_filename( const tripoint &p )
 
 namespace
 {
+/**
+ * Returns pointer to the pooled copy of decoration id \p id, or nullptr if it's empty.
+ * Decoration ids come from a finite set (furniture, traps, vparts, ...),
+ * so the pool is never pruned.
+ */
+const std::string *intern_dec_id( std::string_view id )
+{
+    if( id.empty() ) {
+        return nullptr;
+    }
+    static std::set<std::string, std::less<>> pool;
+    auto it = pool.find( id );
+    if( it == pool.end() ) {
+        it = pool.emplace( id ).first;
+    }
+    return &*it;
+}
+
 /**
  * Helper class for converting global sm coord into
  * global mm_region coord + sm coord within the region.
@@ -82,17 +106,56 @@ const memorized_tile &mm_submap::get_tile( const point_sm_ms &p ) const
     if( tiles.empty() ) {
         return default_tile;
     }
-    return tiles[p.y() * SEEX + p.x()];
+    return palette[tiles[p.y() * SEEX + p.x()]];
+}
+
+void mm_submap::allocate_tiles()
+{
+    // call 'reserve' first to force allocation of exact size
+    tiles.reserve( SEEX * SEEY );
+    tiles.resize( SEEX * SEEY, 0 );
+    palette.reserve( 8 );
+    palette.assign( 1, default_tile );
+    palette_uses.reserve( 8 );
+    palette_uses.assign( 1, SEEX * SEEY );
 }
 
 void mm_submap::set_tile( const point_sm_ms &p, const memorized_tile &value )
 {
     if( tiles.empty() ) {
-        // call 'reserve' first to force allocation of exact size
-        tiles.reserve( SEEX * SEEY );
-        tiles.resize( SEEX * SEEY, default_tile );
+        if( value == default_tile ) {
+            return;
+        }
+        allocate_tiles();
+    }
+    uint8_t &idx = tiles[p.y() * SEEX + p.x()];
+    if( palette[idx] == value ) {
+        return;
+    }
+    for( size_t i = 0; i < palette.size(); i++ ) {
+        if( palette_uses[i] > 0 && palette[i] == value ) {
+            palette_uses[idx]--;
+            palette_uses[i]++;
+            idx = static_cast<uint8_t>( i );
+            return;
+        }
+    }
+    if( palette_uses[idx] == 1 ) {
+        // This position is the only user of the entry, update it in place.
+        palette[idx] = value;
+        return;
+    }
+    palette_uses[idx]--;
+    const auto unused = std::find( palette_uses.begin(), palette_uses.end(), 0 );
+    if( unused != palette_uses.end() ) {
+        idx = static_cast<uint8_t>( std::distance( palette_uses.begin(), unused ) );
+        palette[idx] = value;
+        *unused = 1;
+    } else {
+        idx = static_cast<uint8_t>( palette.size() );
+        palette.push_back( value );
+        palette_uses.push_back( 1 );
     }
-    tiles[p.y() * SEEX + p.x()] = value;
 }
 
 mm_region::mm_region() : submaps( nullptr ) {}
@@ -117,7 +180,8 @@ const std::string &memorized_tile::get_ter_id() const
 
 const std::string &memorized_tile::get_dec_id() const
 {
-    return dec_id;
+    static const std::string empty_dec_id;
+    return dec_id ? *dec_id : empty_dec_id;
 }
 
 void memorized_tile::set_ter_id( std::string_view id )
@@ -127,7 +191,7 @@ void memorized_tile::set_ter_id( std::string_view id )
 
 void memorized_tile::set_dec_id( std::string_view id )
 {
-    dec_id = id;
+    dec_id = intern_dec_id( id );
 }
 
 int memorized_tile::get_ter_rotation() const
@@ -301,16 +365,17 @@ bool map_memory::prepare_region( const tripoint_abs_ms &p1, const tripoint_abs_m
 
     cache_pos = sm_pos;
     cache_size = sm_size.raw();
+    // Cache each z-level in vision range
+    cache_z_min = std::max( sm_pos.z() - fov_3d_z_range, -OVERMAP_DEPTH );
+    cache_z_max = std::min( sm_pos.z() + fov_3d_z_range, OVERMAP_HEIGHT );
     cached.clear();
-    // Loop through each z-level in vision range
-    for( int z = std::max( sm_pos.z() - fov_3d_z_range, -OVERMAP_DEPTH );
-         z <= std::min( sm_pos.z() + fov_3d_z_range, OVERMAP_HEIGHT ); z++ ) {
-        cached[z].reserve( static_cast<std::size_t>( cache_size.x ) * cache_size.y );
+    cached.reserve( static_cast<std::size_t>( cache_size.x ) * cache_size.y *
+                    ( cache_z_max - cache_z_min + 1 ) );
+    for( int z = cache_z_min; z <= cache_z_max; z++ ) {
         for( int dy = 0; dy < cache_size.y; dy++ ) {
             for( int dx = 0; dx < cache_size.x; dx++ ) {
-                // Store submap pointer in cache, categorized by z-level
                 const tripoint_abs_sm smpos( cache_pos.x() + dx, cache_pos.y() + dy, z );
-                cached[z].push_back( fetch_submap( smpos ) );
+                cached.push_back( fetch_submap( smpos ) );
             }
         }
     }
@@ -381,12 +446,14 @@ shared_ptr_fast<mm_submap> map_memory::load_submap( const tripoint_abs_sm &sm_po
     try {
 
         if( world_generator->active_world->has_compression_enabled() ) {
-            std::shared_ptr<zzip_stack> z = zzip_stack::load( mm_dir.get_unrelative_path(),
-                                            ( PATH_INFO::world_base_save_path() / "mmr.dict" ).get_unrelative_path() );
-            if( !z ) {
+            if( !region_zzip ) {
+                region_zzip = zzip_stack::load( mm_dir.get_unrelative_path(),
+                                                ( PATH_INFO::world_base_save_path() / "mmr.dict" ).get_unrelative_path() );
+            }
+            if( !region_zzip ) {
                 return nullptr;
             }
-            if( !read_from_zzip_optional( z, mm_filename, [&]( std::string_view sv ) {
+            if( !read_from_zzip_optional( region_zzip, mm_filename, [&]( std::string_view sv ) {
             JsonValue jsin = json_loader::from_string( std::string( sv ) );
                 loader( jsin );
             } ) ) {
@@ -440,8 +507,9 @@ mm_submap &map_memory::get_submap( const tripoint_abs_sm &sm_pos )
     }
     const point_rel_sm idx = ( sm_pos - cache_pos ).xy();
     if( idx.x() > 0 && idx.y() > 0 && idx.x() < cache_size.x && idx.y() < cache_size.y &&
-        !cached[sm_pos.z()].empty() ) {
-        return *cached[sm_pos.z()][idx.y() * cache_size.x + idx.x()];
+        sm_pos.z() >= cache_z_min && sm_pos.z() <= cache_z_max ) {
+        const std::size_t level_size = static_cast<std::size_t>( cache_size.x ) * cache_size.y;
+        return *cached[( sm_pos.z() - cache_z_min ) * level_size + idx.y() * cache_size.x + idx.x()];
     } else {
         return null_mz_submap;
     }
@@ -474,6 +542,8 @@ bool map_memory::save( const tripoint_abs_ms &pos )
     assure_dir_exist( dirname );
 
     clear_cache();
+    // Saving rewrites the compressed storage, reopen it on next load
+    region_zzip.reset();
 
     dbg( D_INFO ) << "N submaps before save: " << submaps.size();
 
@@ -561,6 +631,7 @@ void map_memory::clear()
 {
     clear_cache();
     submaps.clear();
+    region_zzip.reset();
     dbg( D_INFO ) << "[CLEAR] Done.";
 }
 void map_memory::clear_cache()
@@ -568,4 +639,6 @@ void map_memory::clear_cache()
     cached.clear();
     cache_pos = invalid_cache_pos;
     cache_size = point::zero;
+    cache_z_min = 0;
+    cache_z_max = -1;
 }
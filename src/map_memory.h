@@ -3,9 +3,10 @@
 #define CATA_SRC_MAP_MEMORY_H
 
 #include <cstdint>
-#include <map>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "coordinates.h"
@@ -18,6 +19,7 @@
 class JsonArray;
 class JsonOut;
 class JsonValue;
+class zzip_stack;
 
 class memorized_tile
 {
@@ -46,7 +48,8 @@ class memorized_tile
     private:
         friend struct mm_submap; // serialization needs access to private members
         ter_str_id ter_id;       // terrain tile id
-        std::string dec_id;      // decoration tile id (furniture, vparts ...)
+        // decoration tile id (furniture, vparts ...), interned; nullptr if empty
+        const std::string *dec_id = nullptr;
         int8_t ter_rotation = 0;
         int8_t dec_rotation = 0;
         int8_t ter_subtile = 0;
@@ -73,10 +76,23 @@ struct mm_submap {
         void deserialize( int version, const JsonArray &ja );
 
     private:
+        /**
+         * Tiles are palette-compressed: each distinct tile of the submap is stored
+         * once in #palette and every position holds a 1-byte index into it.
+         * A submap holds at most SEEX*SEEY distinct tiles, so the index always fits.
+         */
+        // NOLINTNEXTLINE(cata-serialize)
+        std::vector<memorized_tile> palette;
+        // Number of positions referencing each palette entry, unused entries get recycled.
+        // NOLINTNEXTLINE(cata-serialize)
+        std::vector<uint8_t> palette_uses;
         // NOLINTNEXTLINE(cata-serialize)
-        std::vector<memorized_tile> tiles; // holds either 0 or SEEX*SEEY elements
+        std::vector<uint8_t> tiles; // holds either 0 or SEEX*SEEY palette indices
         // NOLINTNEXTLINE(cata-serialize)
         bool valid = true;
+
+        /** Allocates storage for all tiles, filled with default_tile. */
+        void allocate_tiles();
 };
 
 /**
@@ -169,11 +185,20 @@ class map_memory
         void clear_tile_decoration( const tripoint_abs_ms &pos, std::string_view prefix = "" );
 
     private:
-        std::map<tripoint_abs_sm, shared_ptr_fast<mm_submap>> submaps;
+        std::unordered_map<tripoint_abs_sm, shared_ptr_fast<mm_submap>> submaps;
 
-        mutable std::map<int, std::vector<shared_ptr_fast<mm_submap>>> cached;
+        /**
+         * Submaps of the prepared region, directly indexed by
+         * ( z - cache_z_min ) * cache_size.x * cache_size.y + y * cache_size.x + x.
+         */
+        std::vector<shared_ptr_fast<mm_submap>> cached;
         tripoint_abs_sm cache_pos;
         point cache_size;
+        int cache_z_min = 0;
+        int cache_z_max = -1;
+
+        /** Compressed region storage, kept open between loads. Dropped on save. */
+        std::shared_ptr<zzip_stack> region_zzip;
 
         /** Find, load or allocate a submap. @returns the submap. */
         shared_ptr_fast<mm_submap> fetch_submap( const tripoint_abs_sm &sm_pos );
@@ -245,13 +245,7 @@ void map::generate( const tripoint_abs_omt &p, const time_point &when, bool save
 
         // This attempts to scale density of zombies inversely with distance from the nearest city.
         // In other words, make city centers dense and perimeters sparse.
-        float density = 0.0f;
-        for( int i = -MON_RADIUS; i <= MON_RADIUS; i++ ) {
-            for( int j = -MON_RADIUS; j <= MON_RADIUS; j++ ) {
-                density += overmap_buffer.ter( { p.x() + i, p.y() + j, gridz } )->get_mondensity();
-            }
-        }
-        density = density / 100;
+        const float density = overmap_buffer.mondensity_sum( { p.xy(), gridz }, MON_RADIUS ) / 100.0f;
 
         // Not sure if we actually have to check all submaps.
         const bool any_missing = !generated.at( get_nonant( tripoint_rel_sm{ point_rel_sm::zero, p_sm.z() } ) )
@@ -3569,7 +3563,7 @@ class jmapgen_nested : public jmapgen_piece
         class neighbor_oter_check
         {
             private:
-                std::unordered_map<direction, cata::flat_set<std::pair<std::string, ot_match_type>>> neighbors;
+                std::unordered_map<direction, std::vector<const oter_matcher *>> neighbors;
             public:
                 explicit neighbor_oter_check( const JsonObject &jsi ) {
                     for( direction dir : all_enum_values<direction>() ) {
@@ -3595,25 +3589,22 @@ class jmapgen_nested : public jmapgen_piece
                             dir_neighbor.second = ot_match_type::contains;
                             dir_neighbors.insert( dir_neighbor );
                         }
-                        if( !dir_neighbors.empty() ) {
-                            neighbors[dir] = std::move( dir_neighbors );
+                        for( const std::pair<std::string, ot_match_type> &dir_neighbor : dir_neighbors ) {
+                            neighbors[dir].push_back( &oter_matcher::get( dir_neighbor.first, dir_neighbor.second ) );
                         }
                     }
                 }
 
                 bool test( const mapgendata &dat ) const {
-                    for( const std::pair<const direction, cata::flat_set<std::pair<std::string, ot_match_type>>> &p :
-                         neighbors ) {
+                    for( const std::pair<const direction, std::vector<const oter_matcher *>> &p : neighbors ) {
                         const direction dir = p.first;
-                        const cata::flat_set<std::pair<std::string, ot_match_type>> &allowed_neighbors = p.second;
+                        const std::vector<const oter_matcher *> &allowed_neighbors = p.second;
 
                         cata_assert( !allowed_neighbors.empty() );
 
                         bool this_direction_matches = false;
-                        for( const std::pair<std::string, ot_match_type> &allowed_neighbor : allowed_neighbors ) {
-                            this_direction_matches |=
-                                is_ot_match( allowed_neighbor.first, dat.neighbor_at( dir ).id(),
-                                             allowed_neighbor.second );
+                        for( const oter_matcher *allowed_neighbor : allowed_neighbors ) {
+                            this_direction_matches |= allowed_neighbor->matches( dat.neighbor_at( dir ).id() );
                         }
                         if( !this_direction_matches ) {
                             return false;
@@ -3735,9 +3726,10 @@ class jmapgen_nested : public jmapgen_piece
         class predecessor_oter_check
         {
             private:
-                cata::flat_set<std::pair<std::string, ot_match_type>> allowed_predecessors;
+                std::vector<const oter_matcher *> allowed_predecessors;
             public:
                 explicit predecessor_oter_check( const JsonArray &jarr ) {
+                    cata::flat_set<std::pair<std::string, ot_match_type>> predecessors;
                     for( const JsonValue entry : jarr ) {
                         std::pair<std::string, ot_match_type> allowed_predecessor;
                         if( entry.test_string() ) {
@@ -3749,15 +3741,18 @@ class jmapgen_nested : public jmapgen_piece
                             allowed_predecessor.second = jo.get_enum_value<ot_match_type>( "om_terrain_match_type",
                                                          ot_match_type::contains );
                         }
-                        allowed_predecessors.insert( allowed_predecessor );
+                        predecessors.insert( allowed_predecessor );
+                    }
+                    for( const std::pair<std::string, ot_match_type> &predecessor : predecessors ) {
+                        allowed_predecessors.push_back( &oter_matcher::get( predecessor.first, predecessor.second ) );
                     }
                 }
 
                 bool test( const mapgendata &dat ) const {
                     const std::vector<oter_id> predecessors = dat.get_predecessors();
-                    for( const std::pair<std::string, ot_match_type> &allowed_predecessor : allowed_predecessors ) {
+                    for( const oter_matcher *allowed_predecessor : allowed_predecessors ) {
                         for( const oter_id &predecessor : predecessors ) {
-                            if( is_ot_match( allowed_predecessor.first, predecessor, allowed_predecessor.second ) ) {
+                            if( allowed_predecessor->matches( predecessor ) ) {
                                 return true;
                             }
                         }
@@ -1147,7 +1147,7 @@ void mapgen_lake_shore( mapgendata &dat )
             // Check if this terrain has an alias to something we actually will extend, and if so, use it.
             for( const shore_extendable_overmap_terrain_alias &alias :
                  settings_lake.shore_extendable_overmap_terrain_aliases ) {
-                if( is_ot_match( alias.overmap_terrain, adjacent, alias.match_type ) ) {
+                if( alias.matcher->matches( adjacent ) ) {
                     match = alias.alias;
                     break;
                 }
@@ -1602,7 +1602,7 @@ void mapgen_ocean_shore( mapgendata &dat )
             // for now, these are the same as lake. They may need to be changed eventually.
             for( const shore_extendable_overmap_terrain_alias &alias :
                  settings_lake.shore_extendable_overmap_terrain_aliases ) {
-                if( is_ot_match( alias.overmap_terrain, adjacent, alias.match_type ) ) {
+                if( alias.matcher->matches( adjacent ) ) {
                     match = alias.alias;
                     break;
                 }
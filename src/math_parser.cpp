@@ -24,6 +24,7 @@
 #include "debug.h"
 #include "dialogue.h"
 #include "dialogue_helpers.h"
+#include "math_parser_bytecode.h"
 #include "math_parser_diag.h"
 #include "math_parser_diag_value.h"
 #include "math_parser_func.h"
@@ -280,12 +281,17 @@ double func_jmath::eval( const_dialogue const &d ) const
 
 double var::eval( const_dialogue const &d ) const
 {
-    if( diag_value const *ret = maybe_read_var_value( varinfo, d ); ret ) {
+    return read( varinfo, d );
+}
+
+double var::read( var_info const &info, const_dialogue const &d )
+{
+    if( diag_value const *ret = maybe_read_var_value( info, d ); ret ) {
         try {
             return ret->dbl( d );
         } catch( math::exception &ex ) {
             throw math::runtime_error(
-                R"(Type mismatch in variable "%s" with value "%s": %s)", varinfo.name,
+                R"(Type mismatch in variable "%s" with value "%s": %s)", info.name,
                 ret->to_string(), ex.what() );
         }
     }
@@ -318,8 +324,18 @@ dot_oper::dot_oper( var_info v_, std::string_view m_ ) : v( std::move( v_ ) )
 
 double dot_oper::eval( const_dialogue const &d ) const
 {
-    tripoint_abs_ms const &tri = read_var_value( v, d ).tripoint( d );
-    switch( member ) {
+    return read( v, member, d );
+}
+
+void dot_oper::assign( dialogue &d, double val ) const
+{
+    write( v, member, d, val );
+}
+
+double dot_oper::read( var_info const &info, char m, const_dialogue const &d )
+{
+    tripoint_abs_ms const &tri = read_var_value( info, d ).tripoint( d );
+    switch( m ) {
         case 'x':
             return tri.x();
         case 'y':
@@ -331,10 +347,10 @@ double dot_oper::eval( const_dialogue const &d ) const
     }
 }
 
-void dot_oper::assign( dialogue &d, double val ) const
+void dot_oper::write( var_info const &info, char m, dialogue &d, double val )
 {
-    tripoint_abs_ms tri = read_var_value( v, d ).tripoint( d );
-    switch( member ) {
+    tripoint_abs_ms tri = read_var_value( info, d ).tripoint( d );
+    switch( m ) {
         case 'x':
             tri.x() = val;
             break;
@@ -348,7 +364,7 @@ void dot_oper::assign( dialogue &d, double val ) const
             throw math::runtime_error( "invalid dot oper" );
     }
 
-    write_var_value( v.type, v.name, &d, tri );
+    write_var_value( info.type, info.name, &d, tri );
 }
 
 kwarg::kwarg( std::string_view key_, thingie val_ )
@@ -460,7 +476,9 @@ class math_exp::math_exp_impl
 {
     public:
         math_exp_impl() = default;
-        explicit math_exp_impl( thingie &&t ): tree( t ) {}
+        explicit math_exp_impl( thingie &&t ): tree( t ) {
+            program.compile( tree );
+        }
 
         bool parse( std::string_view str, bool handle_errors ) {
             if( str.empty() ) {
@@ -475,17 +493,28 @@ class math_exp::math_exp_impl
                     output = {};
                     arity = {};
                     tree = thingie { 0.0 };
+                    program.compile( tree );
                     return false;
                 }
 
                 throw math::exception( error( str, ex.what() ) );
             }
+            program.compile( tree );
             return true;
         }
         double eval( const_dialogue const &d ) const {
+            if( !program.empty() ) {
+                return program.eval( d );
+            }
             return tree.eval( d );
         }
         double eval( dialogue &d ) const {
+            if( !program.empty() ) {
+                return program.eval( d );
+            }
+            return tree.eval( d );
+        }
+        double eval_tree( const_dialogue const &d ) const {
             return tree.eval( d );
         }
 
@@ -524,6 +553,7 @@ class math_exp::math_exp_impl
         };
         std::stack<arity_t> arity;
         thingie tree{ 0.0 };
+        math_program program;
         std::string_view parse_position;
         parse_state state;
         math_type_t type = math_type_t::ret;
@@ -927,7 +957,7 @@ void math_exp::math_exp_impl::new_oper()
                     throw math::syntax_error( "rhs of dot operator must be an identifier" );
                 }
                 var_info const &v = std::get<var>( rhs.data ).varinfo;
-                std::string_view n = v.name;
+                std::string_view n = v.name.str();
 
                 output.emplace( std::in_place_type_t<dot_oper>(), l, n );
 
@@ -1075,6 +1105,11 @@ double math_exp::eval( dialogue &d ) const
     return impl->eval( d );
 }
 
+double math_exp::eval_tree( const_dialogue const &d ) const
+{
+    return impl->eval_tree( d );
+}
+
 math_type_t math_exp::get_type() const
 {
     return impl->get_type();
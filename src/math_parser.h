@@ -26,6 +26,9 @@ class math_exp
         bool parse( std::string_view str, bool handle_errors = true );
         double eval( dialogue &d ) const;
         double eval( const_dialogue const &d ) const;
+        // Evaluates the parse tree directly instead of the compiled program.
+        // For comparing the two in tests.
+        double eval_tree( const_dialogue const &d ) const;
 
         math_type_t get_type() const;
 
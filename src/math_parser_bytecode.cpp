@@ -0,0 +1,373 @@
+#include "math_parser_bytecode.h"
+
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+#include "cata_utility.h"
+#include "condition.h"
+#include "dialogue.h"
+#include "math_parser_diag_value.h"
+#include "math_parser_jmath.h"
+
+namespace
+{
+pmath_func find_function( math_func::f_t f )
+{
+    auto const it = std::find_if( functions.begin(), functions.end(),
+    [f]( math_func const & mf ) {
+        return mf.f == f;
+    } );
+    return it == functions.end() ? nullptr : &*it;
+}
+
+// The value of t if it does not depend on the dialogue or on chance
+std::optional<double> fold( thingie const &t )
+{
+    return std::visit( overloaded{
+        []( double v ) -> std::optional<double>
+        {
+            return v;
+        },
+        []( oper const & v ) -> std::optional<double>
+        {
+            std::optional<double> l = fold( *v.l );
+            if( !l ) {
+                return std::nullopt;
+            }
+            std::optional<double> r = fold( *v.r );
+            if( !r ) {
+                return std::nullopt;
+            }
+            return v.op( *l, *r );
+        },
+        []( func const & v ) -> std::optional<double>
+        {
+            pmath_func const mf = find_function( v.f );
+            if( mf == nullptr || !mf->foldable ) {
+                return std::nullopt;
+            }
+            std::vector<double> params;
+            params.reserve( v.params.size() );
+            for( thingie const &p : v.params ) {
+                std::optional<double> val = fold( p );
+                if( !val ) {
+                    return std::nullopt;
+                }
+                params.push_back( *val );
+            }
+            return v.f( params );
+        },
+        []( ternary const & v ) -> std::optional<double>
+        {
+            std::optional<double> cond = fold( *v.cond );
+            if( !cond ) {
+                return std::nullopt;
+            }
+            return fold( *cond > 0 ? *v.mhs : *v.rhs );
+        },
+        []( auto const & /* v */ ) -> std::optional<double>
+        {
+            return std::nullopt;
+        },
+    },
+    t.data );
+}
+} // namespace
+
+bool math_program::compile( thingie const &tree )
+{
+    code.clear();
+    jmath_ids.clear();
+    vars.clear();
+    diags.clear();
+    if( !compile_node( tree, 0 ) ) {
+        code.clear();
+        jmath_ids.clear();
+        vars.clear();
+        diags.clear();
+        return false;
+    }
+    return true;
+}
+
+std::size_t math_program::var_slot( var_info const &v )
+{
+    auto const it = std::find_if( vars.begin(), vars.end(), [&v]( var_info const & slot ) {
+        return slot.type == v.type && slot.name == v.name;
+    } );
+    if( it != vars.end() ) {
+        return static_cast<std::size_t>( it - vars.begin() );
+    }
+    vars.push_back( v );
+    return vars.size() - 1;
+}
+
+bool math_program::compile_assign_target( thingie const &lhs, instruction &in )
+{
+    return std::visit( overloaded{
+        [this, &in]( var const & v )
+        {
+            in.op = opcode::assign_var;
+            in.index = var_slot( v.varinfo );
+            return true;
+        },
+        [this, &in]( dot_oper const & v )
+        {
+            in.op = opcode::assign_dot;
+            in.index = var_slot( v.v );
+            in.member = v.member;
+            return true;
+        },
+        [this, &in]( func_diag const & v )
+        {
+            in.op = opcode::assign_diag;
+            in.index = diags.size();
+            diags.push_back( v );
+            return true;
+        },
+        []( auto const & /* v */ )
+        {
+            // the tree reports the error
+            return false;
+        },
+    },
+    lhs.data );
+}
+
+void math_program::emit( instruction const &in )
+{
+    code.push_back( in );
+}
+
+bool math_program::compile_params( std::vector<thingie> const &params, int first )
+{
+    for( std::size_t i = 0; i < params.size(); i++ ) {
+        if( !compile_node( params[i], first + static_cast<int>( i ) ) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool math_program::compile_node( thingie const &t, int dst )
+{
+    if( dst >= max_registers ) {
+        return false;
+    }
+    if( std::optional<double> folded = fold( t ); folded ) {
+        instruction in;
+        in.dst = dst;
+        in.value = *folded;
+        emit( in );
+        return true;
+    }
+    return std::visit( overloaded{
+        [this, dst]( oper const & v )
+        {
+            if( !compile_node( *v.l, dst ) || !compile_node( *v.r, dst + 1 ) ) {
+                return false;
+            }
+            instruction in;
+            in.op = opcode::binary;
+            in.dst = dst;
+            in.a = dst;
+            in.b = dst + 1;
+            in.bin = v.op;
+            emit( in );
+            return true;
+        },
+        [this, dst]( ternary const & v )
+        {
+            if( std::optional<double> cond = fold( *v.cond ); cond ) {
+                return compile_node( *cond > 0 ? *v.mhs : *v.rhs, dst );
+            }
+            if( !compile_node( *v.cond, dst ) ) {
+                return false;
+            }
+            const std::size_t to_rhs = code.size();
+            instruction branch;
+            branch.op = opcode::jump_unless;
+            branch.a = dst;
+            emit( branch );
+            if( !compile_node( *v.mhs, dst ) ) {
+                return false;
+            }
+            const std::size_t to_end = code.size();
+            instruction jump;
+            jump.op = opcode::jump;
+            emit( jump );
+            code[to_rhs].index = code.size();
+            if( !compile_node( *v.rhs, dst ) ) {
+                return false;
+            }
+            code[to_end].index = code.size();
+            return true;
+        },
+        [this, dst]( func const & v )
+        {
+            if( !compile_params( v.params, dst ) ) {
+                return false;
+            }
+            instruction in;
+            in.op = opcode::func;
+            in.dst = dst;
+            in.a = dst;
+            in.b = static_cast<int>( v.params.size() );
+            in.func = v.f;
+            emit( in );
+            return true;
+        },
+        [this, dst]( func_jmath const & v )
+        {
+            if( !compile_params( v.params, dst ) ) {
+                return false;
+            }
+            instruction in;
+            in.op = opcode::jmath;
+            in.dst = dst;
+            in.a = dst;
+            in.b = static_cast<int>( v.params.size() );
+            in.index = jmath_ids.size();
+            jmath_ids.push_back( v.id );
+            emit( in );
+            return true;
+        },
+        [this, dst]( ass_oper const & v )
+        {
+            if( !compile_node( *v.mhs, dst ) || !compile_node( *v.rhs, dst + 1 ) ) {
+                return false;
+            }
+            instruction in;
+            in.dst = dst;
+            in.a = dst;
+            in.b = dst + 1;
+            in.bin = v.op;
+            if( !compile_assign_target( *v.lhs, in ) ) {
+                return false;
+            }
+            emit( in );
+            return true;
+        },
+        [this, dst]( var const & v )
+        {
+            instruction in;
+            in.op = opcode::var;
+            in.dst = dst;
+            in.index = var_slot( v.varinfo );
+            emit( in );
+            return true;
+        },
+        [this, dst]( dot_oper const & v )
+        {
+            instruction in;
+            in.op = opcode::dot;
+            in.dst = dst;
+            in.index = var_slot( v.v );
+            in.member = v.member;
+            emit( in );
+            return true;
+        },
+        [this, dst]( func_diag const & v )
+        {
+            instruction in;
+            in.op = opcode::diag;
+            in.dst = dst;
+            in.index = diags.size();
+            diags.push_back( v );
+            emit( in );
+            return true;
+        },
+        []( auto const & /* v */ )
+        {
+            // strings, arrays and kwargs only appear as dialogue function
+            // arguments; leave anything else to the tree
+            return false;
+        },
+    },
+    t.data );
+}
+
+void math_program::assign( instruction const &in, dialogue &d, double val ) const
+{
+    switch( in.op ) {
+        case opcode::assign_var:
+            write_var_value( vars[in.index].type, vars[in.index].name, &d, val );
+            break;
+        case opcode::assign_dot:
+            dot_oper::write( vars[in.index], in.member, d, val );
+            break;
+        case opcode::assign_diag:
+            diags[in.index].assign( d, val );
+            break;
+        default:
+            throw math::internal_error( "math called assign() on unexpected instruction" );
+    }
+}
+
+template<typename D>
+double math_program::run( D &d ) const
+{
+    std::array<double, max_registers> regs{};
+    std::size_t pc = 0;
+    while( pc < code.size() ) {
+        instruction const &in = code[pc];
+        ++pc;
+        switch( in.op ) {
+            case opcode::constant:
+                regs[in.dst] = in.value;
+                break;
+            case opcode::binary:
+                regs[in.dst] = in.bin( regs[in.a], regs[in.b] );
+                break;
+            case opcode::func:
+                regs[in.dst] = in.func( std::vector<double>( regs.begin() + in.a,
+                                        regs.begin() + in.a + in.b ) );
+                break;
+            case opcode::jmath:
+                regs[in.dst] = jmath_ids[in.index]->eval( d, std::vector<double>( regs.begin() + in.a,
+                               regs.begin() + in.a + in.b ) );
+                break;
+            case opcode::var:
+                regs[in.dst] = var::read( vars[in.index], d );
+                break;
+            case opcode::dot:
+                regs[in.dst] = dot_oper::read( vars[in.index], in.member, d );
+                break;
+            case opcode::diag:
+                regs[in.dst] = diags[in.index].eval( d );
+                break;
+            case opcode::assign_var:
+            case opcode::assign_dot:
+            case opcode::assign_diag:
+                if constexpr( std::is_const_v<D> ) {
+                    throw math::runtime_error( "Cannot use assignment operators from eval context" );
+                } else {
+                    assign( in, d, in.bin( regs[in.a], regs[in.b] ) );
+                    regs[in.dst] = 0;
+                }
+                break;
+            case opcode::jump:
+                pc = in.index;
+                break;
+            case opcode::jump_unless:
+                if( !( regs[in.a] > 0 ) ) {
+                    pc = in.index;
+                }
+                break;
+        }
+    }
+    return regs[0];
+}
+
+double math_program::eval( const_dialogue const &d ) const
+{
+    return run( d );
+}
+
+double math_program::eval( dialogue &d ) const
+{
+    return run( d );
+}
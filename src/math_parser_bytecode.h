@@ -0,0 +1,87 @@
+#pragma once
+#ifndef CATA_SRC_MATH_PARSER_BYTECODE_H
+#define CATA_SRC_MATH_PARSER_BYTECODE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "math_parser_func.h"
+#include "math_parser_impl.h"
+#include "type_id.h"
+
+struct const_dialogue;
+struct dialogue;
+
+// A parsed math expression flattened into a list of register instructions so
+// that evaluating it does not have to walk the tree.  Subexpressions that do
+// not depend on the dialogue are folded into constants when compiling.
+// Variables and tripoint members are resolved into slots that an instruction
+// reads or writes directly, and dialogue functions are called without going
+// back through the tree.
+class math_program
+{
+    public:
+        // Returns false, leaving the program empty, if the tree is too deep to
+        // fit the register file.  The caller should then evaluate the tree.
+        bool compile( thingie const &tree );
+
+        bool empty() const {
+            return code.empty();
+        }
+
+        double eval( const_dialogue const &d ) const;
+        double eval( dialogue &d ) const;
+
+        static constexpr int max_registers = 32;
+
+    private:
+        enum class opcode : uint8_t {
+            constant = 0,
+            binary,
+            func,
+            jmath,
+            var,
+            dot,
+            diag,
+            assign_var,
+            assign_dot,
+            assign_diag,
+            jump,
+            jump_unless,
+        };
+
+        struct instruction {
+            opcode op = opcode::constant;
+            int dst = 0;
+            // Operand registers.  For func and jmath, the first parameter
+            // register and the number of parameters.
+            int a = 0;
+            int b = 0;
+            // Jump target, or index into jmath_ids, vars or diags
+            std::size_t index = 0;
+            double value = 0;
+            // Tripoint member for dot and assign_dot
+            char member = 0;
+            binary_op::f_t bin = nullptr;
+            math_func::f_t func = nullptr;
+        };
+
+        bool compile_node( thingie const &t, int dst );
+        bool compile_params( std::vector<thingie> const &params, int first );
+        // Fills in the slot and opcode of an assignment to lhs
+        bool compile_assign_target( thingie const &lhs, instruction &in );
+        std::size_t var_slot( var_info const &v );
+        void emit( instruction const &in );
+        void assign( instruction const &in, dialogue &d, double val ) const;
+
+        template<typename D>
+        double run( D &d ) const;
+
+        std::vector<instruction> code;
+        std::vector<jmath_func_id> jmath_ids;
+        std::vector<var_info> vars;
+        std::vector<func_diag> diags;
+};
+
+#endif // CATA_SRC_MATH_PARSER_BYTECODE_H
@@ -78,6 +78,10 @@ struct dot_oper {
     double eval( const_dialogue const &d ) const;
     void assign( dialogue &d, double val ) const;
 
+    // Member access without a node, for compiled programs
+    static double read( var_info const &info, char m, const_dialogue const &d );
+    static void write( var_info const &info, char m, dialogue &d, double val );
+
     var_info v;
     char member{};
 };
@@ -130,6 +134,9 @@ struct var {
     double eval( const_dialogue const &d ) const;
     void assign( dialogue &d, double val ) const;
 
+    // Variable read without a node, for compiled programs
+    static double read( var_info const &info, const_dialogue const &d );
+
     var_info varinfo;
 };
 struct kwarg {
@@ -49,6 +49,9 @@ static const npc_class_id NC_DOCTOR( "NC_DOCTOR" );
 static const ter_str_id ter_t_floor( "t_floor" );
 static const ter_str_id ter_t_wall_metal( "t_wall_metal" );
 
+static const oter_matcher oter_match_house_prefix( "house", ot_match_type::prefix );
+static const oter_matcher oter_match_s_pharm_prefix( "s_pharm", ot_match_type::prefix );
+
 /* These functions are responsible for making changes to the game at the moment
  * the mission is accepted by the player.  They are also responsible for
  * updating *miss with the target and any other important information.
@@ -182,8 +185,8 @@ void mission_start::place_npc_software( mission *miss )
     tripoint_omt_ms comppoint;
 
     oter_id oter = overmap_buffer.ter( place );
-    if( is_ot_match( "house", oter, ot_match_type::prefix ) ||
-        is_ot_match( "s_pharm", oter, ot_match_type::prefix ) || oter.id().is_empty() ) {
+    if( oter_match_house_prefix.matches( oter ) ||
+        oter_match_s_pharm_prefix.matches( oter ) || oter.id().is_empty() ) {
         comppoint = find_potential_computer_point( compmap );
     }
 
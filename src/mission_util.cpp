@@ -36,6 +36,8 @@
 #include "translations.h"
 #include "type_id.h"
 
+static const oter_matcher oter_match_house_prefix( "house", ot_match_type::prefix );
+
 static tripoint_abs_omt reveal_destination( const std::string &type )
 {
     const tripoint_abs_omt your_pos = get_player_character().pos_abs_omt();
@@ -127,7 +129,7 @@ static tripoint_abs_omt random_house_in_city( const city_reference &cref )
         project_to<coords::omt>( cref.abs_sm_pos );
     std::vector<tripoint_abs_omt> valid;
     for( const tripoint_abs_omt &p : points_in_radius( city_center_omt, cref.city->size ) ) {
-        if( overmap_buffer.check_ot( "house", ot_match_type::prefix, p ) ) {
+        if( overmap_buffer.check_ot( oter_match_house_prefix, p ) ) {
             valid.push_back( p );
         }
     }
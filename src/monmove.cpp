@@ -555,7 +555,9 @@ void monster::plan()
         }
         anger_cub_threatened( mon_plan );
     } else if( friendly != 0 && !mon_plan.docile ) {
-        for( monster &tmp : g->all_monsters() ) {
+        // Nothing beyond MAX_VIEW_DISTANCE can be seen, so it can't be rated as a target.
+        get_creature_tracker().for_each_in_radius( pos_abs(), MAX_VIEW_DISTANCE,
+        [&]( monster & tmp ) {
             if( tmp.friendly == 0 && tmp.attitude_to( *this ) == Attitude::HOSTILE &&
                 seen_levels.test( tmp.posz() + OVERMAP_DEPTH ) ) {
                 float rating = rate_target( tmp, mon_plan.dist, mon_plan.smart_planning );
@@ -564,7 +566,7 @@ void monster::plan()
                     mon_plan.dist = rating;
                 }
             }
-        }
+        } );
     }
 
     if( mon_plan.docile ) {
@@ -635,19 +637,16 @@ void monster::plan()
     int turns_to_skip = max_turns_to_skip * rate_limiting_factor;
     creature_tracker &tracker = get_creature_tracker();
     if( friendly == 0 && ( turns_to_skip == 0 || turns_since_target % turns_to_skip == 0 ) ) {
-        tracker.for_each_reachable( *this, [this]( const mfaction_id & other ) {
+        // Only monsters we could possibly see count as targets, don't look any further.
+        tracker.for_each_reachable_in_radius( *this, MAX_VIEW_DISTANCE,
+        [this]( const mfaction_id & other ) {
             const mf_attitude faction_att = faction->attitude( other );
             return !( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY );
         },
-        [this, &seen_levels, &mon_plan, &valid_targets]( Creature * other ) {
-            if( !seen_levels.test( other->posz() + OVERMAP_DEPTH ) ) {
-                return;
-            }
-            monster *mon_ptr = dynamic_cast<monster *>( other );
-            if( mon_ptr == nullptr ) {
+        [this, &seen_levels, &mon_plan, &valid_targets]( monster & mon ) {
+            if( !seen_levels.test( mon.posz() + OVERMAP_DEPTH ) ) {
                 return;
             }
-            monster &mon = *mon_ptr;
             float rating = rate_target( mon, mon_plan.dist, mon_plan.smart_planning );
             if( rating == mon_plan.dist ) {
                 ++valid_targets;
@@ -703,18 +702,14 @@ void monster::plan()
     const mfaction_id actual_faction = friendly == 0 ? faction : monfaction_player;
     mon_plan.swarms = mon_plan.swarms && mon_plan.target == nullptr; // Only swarm if we have no target
     if( mon_plan.group_morale || mon_plan.swarms ) {
-        tracker.for_each_reachable( *this, [actual_faction]( const mfaction_id & other ) {
+        tracker.for_each_reachable_in_radius( *this, MAX_VIEW_DISTANCE,
+        [actual_faction]( const mfaction_id & other ) {
             return actual_faction == other;
         },
-        [this, &seen_levels, &mon_plan]( Creature * other ) {
-            if( !seen_levels.test( other->posz() + OVERMAP_DEPTH ) ) {
-                return;
-            }
-            monster *mon_ptr = dynamic_cast<monster *>( other );
-            if( mon_ptr == nullptr ) {
+        [this, &seen_levels, &mon_plan]( monster & mon ) {
+            if( !seen_levels.test( mon.posz() + OVERMAP_DEPTH ) ) {
                 return;
             }
-            monster &mon = *mon_ptr;
             float rating = rate_target( mon, mon_plan.dist, mon_plan.smart_planning );
             if( mon_plan.group_morale && rating <= 10 ) {
                 morale += 10 - rating;
@@ -3281,10 +3281,12 @@ void monster::die( map *here, Creature *nkiller )
     if( trigger ) {
         int light = g->light_level( posz() );
         map &here = get_map();
-        for( monster &critter : g->all_monsters() ) {
+        // map::sees won't see further than light, don't look at monsters beyond it.
+        get_creature_tracker().for_each_in_radius( pos_abs(), light >= 0 ? light : MAPSIZE_X,
+        [&]( monster & critter ) {
             // Do we actually care about this faction?
             if( critter.faction->attitude( faction ) != MFA_FRIENDLY ) {
-                continue;
+                return;
             }
 
             if( here.sees( critter.pos_bub(), pos_bub(), light ) ) {
@@ -3303,7 +3305,7 @@ void monster::die( map *here, Creature *nkiller )
                     critter.anger -= 15;
                 }
             }
-        }
+        } );
     }
 }
 
@@ -3994,10 +3996,12 @@ void monster::on_hit( map *here, Creature *source, bodypart_id,
 
     if( trigger ) {
         int light = g->light_level( posz() );
-        for( monster &critter : g->all_monsters() ) {
+        // map::sees won't see further than light, don't look at monsters beyond it.
+        get_creature_tracker().for_each_in_radius( pos_abs(), light >= 0 ? light : MAPSIZE_X,
+        [&]( monster & critter ) {
             // Do we actually care about this faction?
             if( critter.faction->attitude( faction ) != MFA_FRIENDLY ) {
-                continue;
+                return;
             }
 
             if( here->sees( critter.pos_bub( *here ), pos_bub( *here ), light ) ) {
@@ -4016,7 +4020,7 @@ void monster::on_hit( map *here, Creature *source, bodypart_id,
                     critter.anger -= 15;
                 }
             }
-        }
+        } );
     }
     if( source != nullptr ) {
         if( Character *attacker = source->as_character() ) {
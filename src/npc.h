@@ -632,6 +632,25 @@ struct npc_short_term_cache {
     std::optional<int> closest_enemy_to_friendly_distance() const;
 };
 
+// The monsters every npc looks over in assess_danger(), gathered once per turn
+// together with the parts of their threat that do not depend on who is looking.
+struct npc_threat_snapshot {
+    public:
+        struct entry {
+            weak_ptr_fast<monster> critter;
+            // monster::speed_rating() when the snapshot was taken
+            float speed_rating = 0.0f;
+        };
+        std::vector<entry> monsters;
+
+        // Returns the snapshot for this turn, retaken if monsters came or went since
+        static const npc_threat_snapshot &get();
+
+    private:
+        time_point taken = calendar::before_time_starts;
+        uint64_t list_generation = 0;
+};
+
 // npc_combat_memory should store short-term trackers that don't really need to be saved if
 // the player exits the game. Minor logic behaviour changes might occur, but nothing serious.
 struct npc_combat_memory_cache {
@@ -1192,6 +1211,7 @@ class npc : public Character
 
         /** rates how dangerous a target is */
         float evaluate_monster( const monster &target, int dist ) const;
+        float evaluate_monster( const monster &target, int dist, float speed_rating ) const;
         float evaluate_character( const Character &candidate, bool my_gun, bool enemy );
         float evaluate_self( bool my_gun );
 
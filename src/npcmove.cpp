@@ -631,7 +631,11 @@ std::vector<sphere> npc::find_dangerous_explosives() const
 
 float npc::evaluate_monster( const monster &target, int dist ) const
 {
-    float speed = target.speed_rating();
+    return evaluate_monster( target, dist, target.speed_rating() );
+}
+
+float npc::evaluate_monster( const monster &target, int dist, float speed ) const
+{
     float scaled_distance = std::max( 1.0f, dist * dist / ( speed * 250.0f ) );
     float hp_percent = static_cast<float>( target.get_hp() ) / target.get_hp_max();
     float diff = std::max( static_cast<float>( target.type->get_total_difficulty() ),
@@ -859,6 +863,25 @@ static bool too_close( const tripoint_bub_ms &critter_pos, const tripoint_bub_ms
     return rl_dist( critter_pos, ally_pos ) <= def_radius;
 }
 
+const npc_threat_snapshot &npc_threat_snapshot::get()
+{
+    static npc_threat_snapshot snapshot;
+    const creature_tracker &creatures = get_creature_tracker();
+    if( snapshot.taken == calendar::turn &&
+        snapshot.list_generation == creatures.list_generation() ) {
+        return snapshot;
+    }
+    snapshot.monsters.clear();
+    for( const shared_ptr_fast<monster> &critter : creatures.get_monsters_list() ) {
+        if( !critter->is_dead() ) {
+            snapshot.monsters.push_back( { critter, critter->speed_rating() } );
+        }
+    }
+    snapshot.taken = calendar::turn;
+    snapshot.list_generation = creatures.list_generation();
+    return snapshot;
+}
+
 std::optional<int> npc_short_term_cache::closest_enemy_to_friendly_distance() const
 {
     int distance = INT_MAX;
@@ -998,28 +1021,33 @@ void npc::assess_danger()
         ai_cache.hostile_guys.emplace_back( g->shared_from( player_character ) );
     }
 
-    for( const monster &critter : g->all_monsters() ) {
+    for( const npc_threat_snapshot::entry &threat : npc_threat_snapshot::get().monsters ) {
+        const shared_ptr_fast<monster> critter_ptr = threat.critter.lock();
+        if( !critter_ptr || critter_ptr->is_dead() ) {
+            continue;
+        }
+        const monster &critter = *critter_ptr;
         if( !clairvoyant && !here.has_potential_los( pos_bub(), critter.pos_bub() ) ) {
             continue;
         }
         Creature::Attitude att = critter.attitude_to( *this );
         if( att == Attitude::FRIENDLY ) {
-            ai_cache.friends.emplace_back( g->shared_from( critter ) );
+            ai_cache.friends.emplace_back( threat.critter );
             friendly_count += 1;
             continue;
         }
         if( att != Attitude::HOSTILE && ( critter.friendly || !is_enemy() ) ) {
-            ai_cache.neutral_guys.emplace_back( g->shared_from( critter ) );
+            ai_cache.neutral_guys.emplace_back( threat.critter );
             continue;
         }
         if( !sees( here, critter ) ) {
             continue;
         }
 
-        ai_cache.hostile_guys.emplace_back( g->shared_from( critter ) );
+        ai_cache.hostile_guys.emplace_back( threat.critter );
         // warn and consider the odds for distant enemies
         int dist = rl_dist( pos_bub(), critter.pos_bub() );
-        float critter_threat = evaluate_monster( critter, dist );
+        float critter_threat = evaluate_monster( critter, dist, threat.speed_rating );
 
         // ignore targets behind glass even if we can see them
         if( !clear_shot_reach( pos_bub(), critter.pos_bub(), false ) ) {
@@ -1080,7 +1108,7 @@ void npc::assess_danger()
                        "%s assessed threat of critter %s as %1.2f.",
                        name, critter.type->nname(), critter_threat );
         ai_cache.total_danger += critter_threat;
-        float scaled_distance = std::max( 1.0f, dist / critter.speed_rating() );
+        float scaled_distance = std::max( 1.0f, dist / threat.speed_rating );
 
         // don't ignore monsters that are too close or too close to an ally if we can move
         bool is_too_close = dist <= def_radius;
@@ -1108,7 +1136,7 @@ void npc::assess_danger()
         cur_threat_map[direction_from( pos_bub(), critter.pos_bub() )] += priority;
         if( priority > highest_priority ) {
             highest_priority = priority;
-            ai_cache.target = g->shared_from( critter );
+            ai_cache.target = threat.critter;
             ai_cache.danger = critter_threat;
         }
     }
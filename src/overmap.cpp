@@ -89,6 +89,19 @@ static const oter_type_str_id oter_type_road_nesw_manhole( "road_nesw_manhole" )
 static const oter_type_str_id oter_type_sewer_connector( "sewer_connector" );
 static const oter_type_str_id oter_type_sub_station( "sub_station" );
 
+static const oter_matcher oter_match_bridge_prefix( "bridge", ot_match_type::prefix );
+static const oter_matcher oter_match_fema_entrance_prefix( "fema_entrance", ot_match_type::prefix );
+static const oter_matcher oter_match_field_contains( "field", ot_match_type::contains );
+static const oter_matcher oter_match_forest_contains( "forest", ot_match_type::contains );
+static const oter_matcher oter_match_forest_prefix( "forest", ot_match_type::prefix );
+static const oter_matcher oter_match_forest_trail_end_prefix( "forest_trail_end", ot_match_type::prefix );
+static const oter_matcher oter_match_lmoe_prefix( "lmoe", ot_match_type::prefix );
+static const oter_matcher oter_match_radio_tower_prefix( "radio_tower", ot_match_type::prefix );
+static const oter_matcher oter_match_river_contains( "river", ot_match_type::contains );
+static const oter_matcher oter_match_river_prefix( "river", ot_match_type::prefix );
+static const oter_matcher oter_match_road_contains( "road", ot_match_type::contains );
+static const oter_matcher oter_match_swamp_prefix( "swamp", ot_match_type::prefix );
+
 #define dbg(x) DebugLog((x),D_MAP_GEN) << __FILE__ << ":" << __LINE__ << ": "
 
 using oter_type_id = int_id<oter_type_t>;
@@ -322,6 +335,9 @@ void overmap::init_layers()
         // Verify this isn't copying!
         l.map_cache.fill( std::shared_ptr<map_data_summary> { std::shared_ptr<void>(), &passable_omt } );
     }
+    terrain_index.clear();
+    terrain_index_built = false;
+    mondensity_sums.fill( std::nullopt );
 }
 
 void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
@@ -364,6 +380,26 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
     }
     // TODO: maaaaybe this can be set after underlying map data has been changed? IDK.
     set_passable( project_combine( loc, p ), id->get_type_id()->default_map_data );
+    if( terrain_index_built && current_oter != id ) {
+        const oter_id default_oter = get_default_terrain( p.z() );
+        if( current_oter != default_oter ) {
+            std::vector<tripoint_om_omt> &positions = terrain_index[current_oter];
+            const auto it = std::lower_bound( positions.begin(), positions.end(), p );
+            if( it != positions.end() && *it == p ) {
+                positions.erase( it );
+            }
+        }
+        if( id != default_oter ) {
+            std::vector<tripoint_om_omt> &positions = terrain_index[id];
+            positions.insert( std::lower_bound( positions.begin(), positions.end(), p ), p );
+        }
+    }
+    if( current_oter->get_mondensity() != id->get_mondensity() ) {
+        mondensity_sums[p.z() + OVERMAP_DEPTH].reset();
+    }
+    if( current_oter != id ) {
+        overmap_buffer.travel_costs_changed( true );
+    }
     current_oter = id;
 }
 
@@ -429,6 +465,7 @@ void overmap::set_seen( const tripoint_om_omt &p, om_vision_level val, bool forc
     }
 
     layer[p.z() + OVERMAP_DEPTH].visible[p.xy()] = val;
+    overmap_buffer.travel_costs_changed( false );
 
     add_extra_note( p );
 }
@@ -586,6 +623,9 @@ void overmap::add_note( const tripoint_om_omt &p, std::string message )
     } else if( !message.empty() ) {
         it->text = std::move( message );
     } else {
+        if( it->dangerous ) {
+            overmap_buffer.travel_costs_changed( false );
+        }
         notes.erase( it );
     }
 }
@@ -596,6 +636,7 @@ void overmap::mark_note_dangerous( const tripoint_om_omt &p, int radius, bool is
         if( p.xy() == i.p ) {
             i.dangerous = is_dangerous;
             i.danger_radius = radius;
+            overmap_buffer.travel_costs_changed( false );
             return;
         }
     }
@@ -1276,23 +1317,139 @@ const city &overmap::get_invalid_city() const
     return invalid_city;
 }
 
-tripoint_om_omt overmap::find_random_omt( const std::pair<std::string, ot_match_type> &target,
-        std::optional<city> target_city ) const
+void overmap::build_terrain_index() const
 {
-    const bool check_nearest_city = target_city.has_value();
-    std::vector<tripoint_om_omt> valid;
-    for( int i = 0; i < OMAPX; i++ ) {
-        for( int j = 0; j < OMAPY; j++ ) {
-            for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                tripoint_om_omt p( i, j, k );
-                if( is_ot_match( target.first, ter( p ), target.second ) ) {
-                    if( !check_nearest_city || get_nearest_city( p ) == target_city.value() ) {
-                        valid.push_back( p );
-                    }
+    terrain_index.clear();
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        const oter_id default_oter = get_default_terrain( z );
+        const map_layer &l = layer[z + OVERMAP_DEPTH];
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const oter_id &oter = l.terrain[x][y];
+                if( oter != default_oter ) {
+                    terrain_index[oter].emplace_back( x, y, z );
                 }
             }
         }
     }
+    for( auto &[oter, positions] : terrain_index ) {
+        std::sort( positions.begin(), positions.end() );
+    }
+    terrain_index_built = true;
+}
+
+void overmap::build_mondensity_sums( int z ) const
+{
+    // sums[x + y * ( OMAPX + 1 )] is the density of all tiles left of x and above y.
+    std::vector<int> sums( ( OMAPX + 1 ) * ( OMAPY + 1 ), 0 );
+    const map_layer &l = layer[z + OVERMAP_DEPTH];
+    bool any_density = false;
+    for( int y = 0; y < OMAPY; y++ ) {
+        int row = 0;
+        for( int x = 0; x < OMAPX; x++ ) {
+            const int density = l.terrain[x][y]->get_mondensity();
+            any_density |= density != 0;
+            row += density;
+            sums[( x + 1 ) + ( y + 1 ) * ( OMAPX + 1 )] = sums[( x + 1 ) + y * ( OMAPX + 1 )] + row;
+        }
+    }
+    if( !any_density ) {
+        sums.clear();
+    }
+    mondensity_sums[z + OVERMAP_DEPTH] = std::move( sums );
+}
+
+int overmap::mondensity_sum( const point_om_omt &min, const point_om_omt &max, int z ) const
+{
+    if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+        return 0;
+    }
+    const int min_x = std::max( min.x(), 0 );
+    const int min_y = std::max( min.y(), 0 );
+    const int max_x = std::min( max.x(), OMAPX - 1 );
+    const int max_y = std::min( max.y(), OMAPY - 1 );
+    if( min_x > max_x || min_y > max_y ) {
+        return 0;
+    }
+    if( !mondensity_sums[z + OVERMAP_DEPTH] ) {
+        build_mondensity_sums( z );
+    }
+    const std::vector<int> &sums = *mondensity_sums[z + OVERMAP_DEPTH];
+    if( sums.empty() ) {
+        return 0;
+    }
+    const auto at = [&sums]( int x, int y ) {
+        return sums[x + y * ( OMAPX + 1 )];
+    };
+    return at( max_x + 1, max_y + 1 ) - at( min_x, max_y + 1 ) - at( max_x + 1, min_y ) +
+           at( min_x, min_y );
+}
+
+std::vector<tripoint_om_omt> overmap::find_terrain_matches(
+    const std::vector<std::pair<std::string, ot_match_type>> &types, int min_z, int max_z ) const
+{
+    std::vector<const oter_matcher *> matchers;
+    matchers.reserve( types.size() );
+    for( const std::pair<std::string, ot_match_type> &type : types ) {
+        matchers.push_back( &oter_matcher::get( type.first, type.second ) );
+    }
+    return find_terrain_matches( matchers, min_z, max_z );
+}
+
+std::vector<tripoint_om_omt> overmap::find_terrain_matches(
+    const std::vector<const oter_matcher *> &matchers, int min_z, int max_z ) const
+{
+    if( !terrain_index_built ) {
+        build_terrain_index();
+    }
+    const auto matches = [&matchers]( const oter_id & oter ) {
+        return std::any_of( matchers.begin(), matchers.end(), [&oter]( const oter_matcher * matcher ) {
+            return matcher->matches( oter );
+        } );
+    };
+    min_z = std::max( min_z, -OVERMAP_DEPTH );
+    max_z = std::min( max_z, OVERMAP_HEIGHT );
+
+    std::vector<tripoint_om_omt> result;
+    for( const auto &[oter, positions] : terrain_index ) {
+        if( !matches( oter ) ) {
+            continue;
+        }
+        for( const tripoint_om_omt &p : positions ) {
+            if( p.z() >= min_z && p.z() <= max_z ) {
+                result.push_back( p );
+            }
+        }
+    }
+    // The default terrain of each z-level isn't indexed, so look for it the slow way.
+    for( int z = min_z; z <= max_z; z++ ) {
+        const oter_id default_oter = get_default_terrain( z );
+        if( !matches( default_oter ) ) {
+            continue;
+        }
+        const map_layer &l = layer[z + OVERMAP_DEPTH];
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                if( l.terrain[x][y] == default_oter ) {
+                    result.emplace_back( x, y, z );
+                }
+            }
+        }
+    }
+    std::sort( result.begin(), result.end() );
+    return result;
+}
+
+tripoint_om_omt overmap::find_random_omt( const std::pair<std::string, ot_match_type> &target,
+        std::optional<city> target_city ) const
+{
+    const bool check_nearest_city = target_city.has_value();
+    std::vector<tripoint_om_omt> valid = find_terrain_matches( { target } );
+    if( check_nearest_city ) {
+        valid.erase( std::remove_if( valid.begin(), valid.end(), [&]( const tripoint_om_omt & p ) {
+            return !( get_nearest_city( p ) == target_city.value() );
+        } ), valid.end() );
+    }
     return random_entry( valid, tripoint_om_omt::invalid );
 }
 
@@ -1672,15 +1829,15 @@ void overmap::move_nemesis()
         // Hordes will tend toward roads / open fields and path around specials.
         const oter_id &walked_into = ter( project_to<coords::omt>( local_sm ) );
         int movement_chance = 25;
-        if( is_ot_match( "road", walked_into, ot_match_type::contains ) ) {
+        if( oter_match_road_contains.matches( walked_into ) ) {
             movement_chance = 1;
-        } else if( is_ot_match( "field", walked_into, ot_match_type::contains ) ) {
+        } else if( oter_match_field_contains.matches( walked_into ) ) {
             movement_chance = 3;
-        } else if( is_ot_match( "forest", walked_into, ot_match_type::prefix ) ||
-                   is_ot_match( "swamp", walked_into, ot_match_type::prefix ) ||
-                   is_ot_match( "bridge", walked_into, ot_match_type::prefix ) ) {
+        } else if( oter_match_forest_prefix.matches( walked_into ) ||
+                   oter_match_swamp_prefix.matches( walked_into ) ||
+                   oter_match_bridge_prefix.matches( walked_into ) ) {
             movement_chance = 6;
-        } else if( is_ot_match( "river", walked_into, ot_match_type::prefix ) ) {
+        } else if( oter_match_river_prefix.matches( walked_into ) ) {
             movement_chance = 10;
         }
 
@@ -1884,7 +2041,7 @@ void overmap::place_forest_trails()
             tripoint_om_omt seed_point( i, j, 0 );
 
             oter_id oter = ter( seed_point );
-            if( !is_ot_match( "forest", oter, ot_match_type::prefix ) ) {
+            if( !oter_match_forest_prefix.matches( oter ) ) {
                 continue;
             }
 
@@ -2012,7 +2169,7 @@ void overmap::place_forest_trailheads()
                  trailhead,
                  settings_forest_trail.trailhead_road_distance
              ) ) {
-            if( check_ot( "road", ot_match_type::contains, nearby_point ) ) {
+            if( check_ot( oter_match_road_contains, nearby_point ) ) {
                 close = true;
             }
         }
@@ -2034,7 +2191,7 @@ void overmap::place_forest_trailheads()
         for( int j = 2; j < OMAPY - 2; j++ ) {
             const tripoint_om_omt p( i, j, 0 );
             oter_id oter = ter( p );
-            if( is_ot_match( "forest_trail_end", oter, ot_match_type::prefix ) ) {
+            if( oter_match_forest_trail_end_prefix.matches( oter ) ) {
                 try_place_trailhead_special( p, static_cast<om_direction::type>( oter->get_rotation() ) );
             }
         }
@@ -2117,7 +2274,7 @@ void overmap::place_swamps()
         for( int y = 0; y < OMAPY; y++ ) {
             const tripoint_om_omt pos( x, y, 0 );
             // TODO: Use is_river or similar not a ot match
-            if( is_ot_match( "river", ter_unsafe( pos ), ot_match_type::contains ) ) {
+            if( oter_match_river_contains.matches( ter_unsafe( pos ) ) ) {
                 std::vector<point_om_omt> buffered_points =
                     closest_points_first(
                         pos.xy(),
@@ -2141,7 +2298,7 @@ void overmap::place_swamps()
             const tripoint_om_omt pos( x, y, 0 );
             // If this location isn't a forest, there's nothing to do here. We'll only grow swamps in existing
             // forest terrain.
-            if( !is_ot_match( "forest", ter( pos ), ot_match_type::contains ) ) {
+            if( !oter_match_forest_contains.matches( ter( pos ) ) ) {
                 continue;
             }
 
@@ -2737,15 +2894,13 @@ void overmap::polish_river( const std::vector<const overmap *> &neighbor_overmap
     }
 }
 
-bool overmap::check_ot( const std::string &otype, ot_match_type match_type,
-                        const tripoint_om_omt &p ) const
+bool overmap::check_ot( const oter_matcher &matcher, const tripoint_om_omt &p ) const
 {
     /// TODO: this check should be done by the caller. Probably.
     if( !inbounds( p ) ) {
         return false;
     }
-    const oter_id &oter = ter( p );
-    return is_ot_match( otype, oter, match_type );
+    return matcher.matches( ter( p ) );
 }
 
 bool overmap::check_overmap_special_type( const overmap_special_id &id,
@@ -3670,7 +3825,7 @@ void overmap::place_radios()
             tripoint_om_omt pos_omt( i, j, 0 );
             point_om_sm pos_sm = project_to<coords::sm>( pos_omt.xy() );
             // Since location have id such as "radio_tower_1_north", we must check the beginning of the id
-            if( is_ot_match( "radio_tower", ter( pos_omt ), ot_match_type::prefix ) ) {
+            if( oter_match_radio_tower_prefix.matches( ter( pos_omt ) ) ) {
                 if( one_in( 3 ) ) {
                     radios.emplace_back( pos_sm, strength(), "", radio_type::WEATHER_RADIO );
                 } else {
@@ -3678,11 +3833,11 @@ void overmap::place_radios()
                                                   translation() ).translated() );
                     radios.emplace_back( pos_sm, strength(), message );
                 }
-            } else if( is_ot_match( "lmoe", ter( pos_omt ), ot_match_type::prefix ) ) {
+            } else if( oter_match_lmoe_prefix.matches( ter( pos_omt ) ) ) {
                 message = string_format( _( "This is automated emergency shelter beacon %d%d."
                                             "  Supplies, amenities and shelter are stocked." ), i, j );
                 radios.emplace_back( pos_sm, strength() / 2, message );
-            } else if( is_ot_match( "fema_entrance", ter( pos_omt ), ot_match_type::prefix ) ) {
+            } else if( oter_match_fema_entrance_prefix.matches( ter( pos_omt ) ) ) {
                 message = string_format( _( "This is FEMA camp %d%d."
                                             "  Supplies are limited, please bring supplemental food, water, and bedding."
                                             "  This is FEMA camp %d%d.  A designated long-term emergency shelter." ), i, j, i, j );
@@ -57,6 +57,7 @@ class character_id;
 class monster;
 class npc;
 class overmap_connection;
+class oter_matcher;
 struct horde_entity;
 struct pp_resolved_generator;
 struct map_data_summary;
@@ -489,6 +490,26 @@ class overmap
          * coordinates), or empty vector if no matching terrain is found.
          */
         std::vector<point_abs_omt> find_terrain( std::string_view term, int zlevel ) const;
+        /**
+         * Return the (local) coordinates of every tile on z-levels @p min_z
+         * to @p max_z whose terrain matches any of @p types, sorted.
+         * This is a lookup in an index of terrain positions, so it's much
+         * cheaper than checking every tile of the overmap.
+         */
+        std::vector<tripoint_om_omt> find_terrain_matches(
+            const std::vector<std::pair<std::string, ot_match_type>> &types,
+            int min_z = -OVERMAP_DEPTH, int max_z = OVERMAP_HEIGHT ) const;
+        std::vector<tripoint_om_omt> find_terrain_matches(
+            const std::vector<const oter_matcher *> &matchers,
+            int min_z = -OVERMAP_DEPTH, int max_z = OVERMAP_HEIGHT ) const;
+
+        /**
+         * Return the sum of the monster density of the terrain in the rectangle
+         * from @p min to @p max (inclusive, clipped to the overmap) on z-level @p z.
+         * This is a lookup in a table of partial sums, so the size of the rectangle
+         * doesn't matter.
+         */
+        int mondensity_sum( const point_om_omt &min, const point_om_omt &max, int z ) const;
 
         void ter_set( const tripoint_om_omt &p, const oter_id &id );
         // ter has bounds checking, and returns ot_null when out of bounds.
@@ -674,6 +695,21 @@ class overmap
         std::array<map_layer, OVERMAP_LAYERS> layer;
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
 
+        // Sorted positions of each terrain on this overmap, used by find_terrain_matches().
+        // Built on first use and kept up to date by ter_set().  Tiles with the default
+        // terrain of their z-level are left out, they make up most of the overmap.
+        mutable std::unordered_map<oter_id, std::vector<tripoint_om_omt>>
+                terrain_index; // NOLINT(cata-serialize)
+        mutable bool terrain_index_built = false; // NOLINT(cata-serialize)
+        void build_terrain_index() const;
+
+        // Summed-area tables of the terrain monster density of each z-level, used by
+        // mondensity_sum().  Built on first use and dropped by ter_set() when the
+        // density changes.  The table is left empty if the whole layer has no density.
+        mutable std::array<std::optional<std::vector<int>>, OVERMAP_LAYERS>
+                mondensity_sums; // NOLINT(cata-serialize)
+        void build_mondensity_sums( int z ) const;
+
         // Records the locations where a given overmap special was placed, which
         // can be used after placement to lookup whether a given location was created
         // as part of a special.
@@ -925,8 +961,7 @@ class overmap
         void connect_closest_points( const std::vector<point_om_omt> &points, int z,
                                      const overmap_connection &connection );
         // Polishing
-        bool check_ot( const std::string &otype, ot_match_type match_type,
-                       const tripoint_om_omt &p ) const;
+        bool check_ot( const oter_matcher &matcher, const tripoint_om_omt &p ) const;
         bool check_overmap_special_type( const overmap_special_id &id,
                                          const tripoint_om_omt &location ) const;
         std::optional<overmap_special_id> overmap_special_at( const tripoint_om_omt &p ) const;
@@ -1114,6 +1149,34 @@ bool is_highway_special( const oter_id &ter );
 bool is_ot_match( const std::string &name, const oter_id &oter,
                   ot_match_type match_type );
 
+/**
+* is_ot_match() compiled for a fixed name and match type.  The result for every
+* overmap terrain is computed once, after which matching is a single bit test.
+* Can be constructed before the terrains are loaded: it compiles on first use
+* after finalization and recompiles when the terrains are reloaded.
+*/
+class oter_matcher
+{
+    public:
+        oter_matcher( const std::string &name, ot_match_type match_type );
+
+        bool matches( const oter_id &oter ) const;
+
+        /**
+         * Shared matcher for the name and match type, for names that aren't known up front.
+         * The matcher lives for the rest of the program, so data loaded from json should
+         * look it up once on load and keep the pointer.
+         */
+        static const oter_matcher &get( const std::string &name, ot_match_type match_type );
+    private:
+        void compile() const;
+
+        std::string name;
+        ot_match_type match_type;
+        mutable std::vector<bool> matching;
+        mutable int compiled_version = -1;
+};
+
 /**
 * Gets a collection of sectors and their width for usage in placing overmap specials.
 * @param sector_width used to divide the OMAPX by OMAPY map into sectors.
@@ -2,8 +2,11 @@
 #include "overmap.h" // IWYU pragma: associated
 
 #include <cstring>
+#include <map>
 #include <optional>
 #include <ostream>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "cached_options.h"
@@ -84,6 +87,9 @@ namespace
 generic_factory<overmap_land_use_code> land_use_codes( "overmap land use codes" );
 generic_factory<oter_type_t> terrain_types( "overmap terrain type" );
 generic_factory<oter_t> terrains( "overmap terrain" );
+// Incremented whenever the set of terrains changes, so oter_matcher knows to recompile.
+int terrains_version = 0;
+bool terrains_finalized = false;
 
 } // namespace
 
@@ -350,6 +356,45 @@ bool is_ot_match( const std::string &name, const oter_id &oter,
     }
 }
 
+oter_matcher::oter_matcher( const std::string &name, ot_match_type match_type ) :
+    name( name ), match_type( match_type )
+{
+}
+
+void oter_matcher::compile() const
+{
+    const std::vector<oter_t> &all = terrains.get_all();
+    matching.assign( all.size(), false );
+    for( const oter_t &oter : all ) {
+        const oter_id id = oter.id.id();
+        matching[id.to_i()] = is_ot_match( name, id, match_type );
+    }
+    compiled_version = terrains_version;
+}
+
+bool oter_matcher::matches( const oter_id &oter ) const
+{
+    if( !terrains_finalized ) {
+        return is_ot_match( name, oter, match_type );
+    }
+    if( compiled_version != terrains_version ) {
+        compile();
+    }
+    const size_t index = oter.to_i();
+    return index < matching.size() && matching[index];
+}
+
+const oter_matcher &oter_matcher::get( const std::string &name, ot_match_type match_type )
+{
+    static std::map<std::pair<std::string, ot_match_type>, oter_matcher> matchers;
+    auto it = matchers.find( std::make_pair( name, match_type ) );
+    if( it == matchers.end() ) {
+        it = matchers.emplace( std::make_pair( name, match_type ),
+                               oter_matcher( name, match_type ) ).first;
+    }
+    return it->second;
+}
+
 /*
  * load mapgen functions from an overmap_terrain json entry
  * suffix is for roads/subways/etc which have "_straight", "_curved", "_tee", "_four_way" function mappings
@@ -921,12 +966,16 @@ void overmap_terrains::finalize()
 {
     terrain_types.finalize();
     set_oter_ids();
+    terrains_version++;
+    terrains_finalized = true;
 }
 
 void overmap_terrains::reset()
 {
     terrain_types.reset();
     terrains.reset();
+    terrains_version++;
+    terrains_finalized = false;
 }
 
 const std::vector<oter_t> &overmap_terrains::get_all()
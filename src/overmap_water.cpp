@@ -44,6 +44,8 @@ static const oter_str_id oter_river_south( "river_south" );
 static const oter_str_id oter_river_sw( "river_sw" );
 static const oter_str_id oter_river_west( "river_west" );
 
+static const oter_matcher oter_match_river_prefix( "river", ot_match_type::prefix );
+
 void overmap::place_river( const std::vector<const overmap *> &neighbor_overmaps,
                            const overmap_river_node &initial_points, int river_scale, bool major_river )
 {
@@ -733,7 +735,7 @@ void overmap::build_river_shores( const std::vector<const overmap *> &neighbor_o
 {
     const int neighbor_overmap_size = neighbor_overmaps.size();
     // TODO: Change this to the flag (or an else that sets a different bool?) and add handling for bridge maps to get overwritten by the correct tile then replaced
-    if( !is_ot_match( "river", ter( p ), ot_match_type::prefix ) ) {
+    if( !oter_match_river_prefix.matches( ter( p ) ) ) {
         return;
     }
     // Find and assign shores where they need to be.
@@ -112,6 +112,7 @@ overmap &overmapbuffer::get( const point_abs_om &p )
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
     global_state.overmap_count++;
+    travel_costs_changed( true );
     new_om.populate();
     // Note: fix_mongroups might load other overmaps, so overmaps.back() is not
     // necessarily the overmap at (x,y)
@@ -132,6 +133,7 @@ void overmapbuffer::create_custom_overmap( const point_abs_om &p, overmap_specia
     }
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
     global_state.overmap_count++;
+    travel_costs_changed( true );
     new_om.populate( specials );
 }
 
@@ -255,6 +257,7 @@ void overmapbuffer::save()
 void overmapbuffer::reset()
 {
     overmaps.clear();
+    travel_path_cache.clear();
     global_state.highway_intersections.clear();
     last_requested_overmap = nullptr;
 }
@@ -262,6 +265,7 @@ void overmapbuffer::reset()
 void overmapbuffer::clear()
 {
     overmaps.clear();
+    travel_path_cache.clear();
     known_non_existing.clear();
     global_state.clear();
     last_requested_overmap = nullptr;
@@ -388,6 +392,26 @@ bool overmapbuffer::has( const point_abs_om &p )
     return get_existing( p ) != nullptr;
 }
 
+bool overmapbuffer::prepare_overmap_near( const tripoint_abs_omt &center, int margin )
+{
+    const point_abs_om center_om = project_to<coords::om>( center.xy() );
+    for( const point_abs_om &om : closest_points_first( center_om, 1 ) ) {
+        if( overmaps.count( om ) ) {
+            continue;
+        }
+        const point_abs_omt near_corner = project_to<coords::omt>( om );
+        const point_abs_omt far_corner = near_corner + point( OMAPX - 1, OMAPY - 1 );
+        const int dx = std::max( { near_corner.x() - center.x(), center.x() - far_corner.x(), 0 } );
+        const int dy = std::max( { near_corner.y() - center.y(), center.y() - far_corner.y(), 0 } );
+        if( std::max( dx, dy ) > margin ) {
+            continue;
+        }
+        get( om );
+        return true;
+    }
+    return false;
+}
+
 overmap_with_local_coords
 overmapbuffer::get_om_global( const point_abs_omt &p )
 {
@@ -906,6 +930,24 @@ const oter_id &overmapbuffer::ter( const tripoint_abs_omt &p )
     return om_loc.om->ter( om_loc.local );
 }
 
+int overmapbuffer::mondensity_sum( const tripoint_abs_omt &p, int radius )
+{
+    const point_abs_omt min = p.xy() + point_rel_omt( -radius, -radius );
+    const point_abs_omt max = p.xy() + point_rel_omt( radius, radius );
+    const point_abs_om om_min = project_to<coords::om>( min );
+    const point_abs_om om_max = project_to<coords::om>( max );
+    int sum = 0;
+    for( int om_x = om_min.x(); om_x <= om_max.x(); om_x++ ) {
+        for( int om_y = om_min.y(); om_y <= om_max.y(); om_y++ ) {
+            const point_abs_om om_pos( om_x, om_y );
+            const point_abs_omt origin = project_to<coords::omt>( om_pos );
+            sum += get( om_pos ).mondensity_sum( point_om_omt( ( min - origin ).raw() ),
+                                                 point_om_omt( ( max - origin ).raw() ), p.z() );
+        }
+    }
+    return sum;
+}
+
 const oter_id &overmapbuffer::ter_existing( const tripoint_abs_omt &p )
 {
     static const oter_id ot_null;
@@ -1118,6 +1160,18 @@ pf::simple_path<tripoint_abs_omt> overmapbuffer::get_travel_path(
         return {};
     }
 
+    // NPCs, camp missions and the travel UI often ask for the same route over and
+    // over again, and searches that fail are the most expensive ones.
+    const bool uses_knowledge = params.uses_player_knowledge();
+    for( const cached_travel_path &cached : travel_path_cache ) {
+        if( cached.src == src && cached.dest == dest &&
+            cached.terrain_version == travel_terrain_version &&
+            ( !uses_knowledge || cached.knowledge_version == travel_knowledge_version ) &&
+            cached.params == params ) {
+            return cached.path;
+        }
+    }
+
     const pf::omt_scoring_fn estimate = [&]( tripoint_abs_omt pos ) {
         int cur_cost = get_terrain_cost( pos, params );
         if( cur_cost < 0 ) {
@@ -1133,9 +1187,28 @@ pf::simple_path<tripoint_abs_omt> overmapbuffer::get_travel_path(
     constexpr int radius = 4 * OMAPX; // radius of search in OMTs = 4 overmaps
     const pf::simple_path<tripoint_abs_omt> &path = pf::find_overmap_path( src, dest, radius, estimate,
             game::display_om_pathfinding_progress, std::nullopt, params.allow_diagonal );
+
+    static constexpr size_t max_cached_travel_paths = 32;
+    if( travel_path_cache.size() >= max_cached_travel_paths ) {
+        travel_path_cache.erase( travel_path_cache.begin() );
+    }
+    travel_path_cache.push_back( { src, dest, params, travel_terrain_version,
+                                   travel_knowledge_version, path } );
     return path;
 }
 
+void overmapbuffer::travel_costs_changed( bool terrain )
+{
+    if( travel_path_cache.empty() ) {
+        return;
+    }
+    if( terrain ) {
+        travel_terrain_version++;
+    } else {
+        travel_knowledge_version++;
+    }
+}
+
 bool overmapbuffer::reveal_route( const tripoint_abs_omt &source, const tripoint_abs_omt &dest,
                                   int radius, bool road_only )
 {
@@ -1193,14 +1266,13 @@ bool overmapbuffer::reveal_route( const tripoint_abs_omt &source, const tripoint
     return !path.nodes.empty();
 }
 
-bool overmapbuffer::check_ot_existing( const std::string &type, ot_match_type match_type,
-                                       const tripoint_abs_omt &loc )
+bool overmapbuffer::check_ot_existing( const oter_matcher &matcher, const tripoint_abs_omt &loc )
 {
     const overmap_with_local_coords om_loc = get_existing_om_global( loc );
     if( !om_loc ) {
         return false;
     }
-    return om_loc.om->check_ot( type, match_type, om_loc.local );
+    return om_loc.om->check_ot( matcher, om_loc.local );
 }
 
 bool overmapbuffer::check_overmap_special_type_existing(
@@ -1227,11 +1299,10 @@ std::optional<mapgen_arguments> overmapbuffer::get_existing_omt_stack_arguments(
     return om_loc.om->get_existing_omt_stack_arguments( p );
 }
 
-bool overmapbuffer::check_ot( const std::string &type, ot_match_type match_type,
-                              const tripoint_abs_omt &p )
+bool overmapbuffer::check_ot( const oter_matcher &matcher, const tripoint_abs_omt &p )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    return om_loc.om->check_ot( type, match_type, om_loc.local );
+    return om_loc.om->check_ot( matcher, om_loc.local );
 }
 
 bool overmapbuffer::check_overmap_special_type( const overmap_special_id &id,
@@ -1278,20 +1349,30 @@ static omt_find_params assign_params(
     return params;
 }
 
+std::vector<const oter_matcher *> omt_find_params::type_matchers() const
+{
+    std::vector<const oter_matcher *> matchers;
+    matchers.reserve( types.size() );
+    for( const std::pair<std::string, ot_match_type> &elem : types ) {
+        matchers.push_back( &oter_matcher::get( elem.first, elem.second ) );
+    }
+    return matchers;
+}
+
 bool overmapbuffer::is_findable_location( const tripoint_abs_omt &location,
-        const omt_find_params &params )
+        const omt_find_params &params, const std::vector<const oter_matcher *> &matchers )
 {
     bool type_matches = false;
     if( params.existing_only ) {
-        for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
-            type_matches = check_ot_existing( elem.first, elem.second, location );
+        for( const oter_matcher *matcher : matchers ) {
+            type_matches = check_ot_existing( *matcher, location );
             if( type_matches ) {
                 break;
             }
         }
     } else {
-        for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
-            type_matches = check_ot( elem.first, elem.second, location );
+        for( const oter_matcher *matcher : matchers ) {
+            type_matches = check_ot( *matcher, location );
             if( type_matches ) {
                 break;
             }
@@ -1323,6 +1404,37 @@ bool overmapbuffer::is_findable_location( const tripoint_abs_omt &location,
     return true;
 }
 
+// Overmaps with any tile within square distance min_dist to max_dist of origin,
+// paired with the smallest distance from origin to any of their tiles and
+// sorted by it.
+static std::vector<std::pair<int, point_abs_om>> overmaps_in_range( const point_abs_omt &origin,
+        int min_dist, int max_dist )
+{
+    std::vector<std::pair<int, point_abs_om>> result;
+    const point_abs_om om_min = project_to<coords::om>( origin - point( max_dist, max_dist ) );
+    const point_abs_om om_max = project_to<coords::om>( origin + point( max_dist, max_dist ) );
+    for( int x = om_min.x(); x <= om_max.x(); x++ ) {
+        for( int y = om_min.y(); y <= om_max.y(); y++ ) {
+            const point_abs_om om( x, y );
+            const point_abs_omt near_corner = project_to<coords::omt>( om );
+            const point_abs_omt far_corner = near_corner + point( OMAPX - 1, OMAPY - 1 );
+            const int dx = std::max( { near_corner.x() - origin.x(), origin.x() - far_corner.x(), 0 } );
+            const int dy = std::max( { near_corner.y() - origin.y(), origin.y() - far_corner.y(), 0 } );
+            const int farthest = std::max( { origin.x() - near_corner.x(), far_corner.x() - origin.x(),
+                                             origin.y() - near_corner.y(), far_corner.y() - origin.y()
+                                           } );
+            if( farthest >= min_dist ) {
+                result.emplace_back( std::max( dx, dy ), om );
+            }
+        }
+    }
+    std::stable_sort( result.begin(), result.end(),
+    []( const std::pair<int, point_abs_om> &l, const std::pair<int, point_abs_om> &r ) {
+        return l.first < r.first;
+    } );
+    return result;
+}
+
 tripoint_abs_omt overmapbuffer::find_closest(
     const tripoint_abs_omt &origin, const std::string &type, int const radius, bool must_be_seen,
     ot_match_type match_type, bool existing_overmaps_only,
@@ -1336,8 +1448,9 @@ tripoint_abs_omt overmapbuffer::find_closest(
 tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
+    const std::vector<const oter_matcher *> matchers = params.type_matchers();
     // Check the origin before searching adjacent tiles!
-    if( params.min_distance == 0 && is_findable_location( origin, params ) ) {
+    if( params.min_distance == 0 && is_findable_location( origin, params, matchers ) ) {
         return origin;
     }
 
@@ -1378,7 +1491,7 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
                     for( auto &element : om_data.overmap_special_placements ) {
                         if( element.second == special_id ) {
                             const tripoint_abs_omt loc = om_base + element.first.raw();
-                            if( is_findable_location( loc, params ) ) {
+                            if( is_findable_location( loc, params, matchers ) ) {
                                 const int dist_xy = square_dist( origin.xy(), loc.xy() );
 
                                 if( dist_xy >= min_dist && dist_xy < max_dist ) {
@@ -1414,24 +1527,30 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
 
         return tripoint_abs_omt::invalid;
     } else {
-
-        for( const point_abs_omt &loc_xy : closest_points_first( origin.xy(), min_dist, max_dist ) ) {
-            const int dist_xy = square_dist( origin.xy(), loc_xy );
-
-            if( found_dist < dist_xy ) {
+        // Look the terrain up in the index of each overmap in range, nearest
+        // overmaps first, and stop once the remaining ones are all too far away.
+        for( const auto &[om_dist, om] : overmaps_in_range( origin.xy(), min_dist, max_dist ) ) {
+            if( found_dist < om_dist ) {
                 break;
             }
-
-            for( int z = params.min_z; z <= params.max_z; z++ ) {
-                const tripoint_abs_omt loc( loc_xy, z );
+            if( params.existing_only && !has( om ) ) {
+                continue;
+            }
+            const overmap &om_data = get( om );
+            for( const tripoint_om_omt &p : om_data.find_terrain_matches( matchers, params.min_z,
+                    params.max_z ) ) {
+                const tripoint_abs_omt loc = project_combine( om, p );
+                const int dist_xy = square_dist( origin.xy(), loc.xy() );
                 const int dist = square_dist( origin, loc );
-
-                if( found_dist < dist ) {
+                if( dist_xy < min_dist || dist_xy > max_dist || found_dist < dist ) {
                     continue;
                 }
 
-                if( is_findable_location( loc, params ) ) {
-                    found_dist = dist;
+                if( is_findable_location( loc, params, matchers ) ) {
+                    if( dist < found_dist ) {
+                        found_dist = dist;
+                        result.clear();
+                    }
                     result.push_back( loc );
                 }
             }
@@ -1451,6 +1570,7 @@ tripoint_abs_omt overmapbuffer::find_existing_globally_unique( const tripoint_ab
     // invalid (because the entry is converted from an earlier version where the position wasn't
     // recorded).
     const tripoint_abs_om center = coords::project_to<coords::om>( origin );
+    const std::vector<const oter_matcher *> matchers = params.type_matchers();
 
     // Very long range which will take forever if filled. Max is an arbitrary number.
     const overmap_special_id special_id = params.om_special.value();
@@ -1462,7 +1582,7 @@ tripoint_abs_omt overmapbuffer::find_existing_globally_unique( const tripoint_ab
             for( auto &element : om_data.overmap_special_placements ) {
                 if( element.second == special_id ) {
                     const tripoint_abs_omt loc = om_base + element.first.raw();
-                    if( is_findable_location( loc, params ) ) {
+                    if( is_findable_location( loc, params, matchers ) ) {
                         return loc;
                     }
                 }
@@ -1476,6 +1596,7 @@ tripoint_abs_omt overmapbuffer::find_existing_globally_unique( const tripoint_ab
 std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
+    const std::vector<const oter_matcher *> matchers = params.type_matchers();
     std::vector<tripoint_abs_omt> result;
     // dist == 0 means search a whole overmap diameter.
     const int min_dist = params.min_distance;
@@ -1497,7 +1618,7 @@ std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &o
                 for( auto &element : om_data.overmap_special_placements ) {
                     if( element.second == special_id ) {
                         const tripoint_abs_omt loc = om_base + element.first.raw();
-                        if( is_findable_location( loc, params ) ) {
+                        if( is_findable_location( loc, params, matchers ) ) {
                             const int dist_xy = square_dist( origin.xy(), loc.xy() );
 
                             if( dist_xy >= min_dist && dist_xy < max_dist ) {
@@ -1509,11 +1630,26 @@ std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &o
             }
         }
     } else {
-        for( const tripoint_abs_omt &loc : closest_points_first( origin, min_dist, max_dist ) ) {
-            if( is_findable_location( loc, params ) ) {
-                result.push_back( loc );
+        for( const auto &[om_dist, om] : overmaps_in_range( origin.xy(), min_dist, max_dist ) ) {
+            if( params.existing_only && !has( om ) ) {
+                continue;
+            }
+            const overmap &om_data = get( om );
+            for( const tripoint_om_omt &p : om_data.find_terrain_matches( matchers, origin.z(),
+                    origin.z() ) ) {
+                const tripoint_abs_omt loc = project_combine( om, p );
+                const int dist_xy = square_dist( origin.xy(), loc.xy() );
+                if( dist_xy >= min_dist && dist_xy <= max_dist &&
+                    is_findable_location( loc, params, matchers ) ) {
+                    result.push_back( loc );
+                }
             }
         }
+        // Closest first, like the search used to return them
+        std::stable_sort( result.begin(), result.end(),
+        [&origin]( const tripoint_abs_omt & l, const tripoint_abs_omt & r ) {
+            return square_dist( origin, l ) < square_dist( origin, r );
+        } );
     }
 
     return result;
@@ -65,6 +65,14 @@ struct overmap_path_params {
         return it != travel_cost_per_type.end() ? it->second : -1;
     }
     static constexpr int standard_cost = 10;
+    bool operator==( const overmap_path_params &rhs ) const {
+        return travel_cost_per_type == rhs.travel_cost_per_type && avoid_danger == rhs.avoid_danger &&
+               only_known_by_player == rhs.only_known_by_player && allow_diagonal == rhs.allow_diagonal;
+    }
+    // Whether paths depend on what the player knows about the overmap.
+    bool uses_player_knowledge() const {
+        return avoid_danger || only_known_by_player;
+    }
     static overmap_path_params for_player();
     static overmap_path_params for_npc();
     static overmap_path_params for_land_vehicle( float offroad_coeff, bool tiny, bool amphibious );
@@ -153,6 +161,9 @@ struct omt_find_params {
     int min_z = -OVERMAP_DEPTH;
     int max_z = OVERMAP_HEIGHT;
     std::optional<overmap_special_id> om_special = std::nullopt;
+
+    /** @ref types resolved to their shared matchers, see oter_matcher::get(). */
+    std::vector<const oter_matcher *> type_matchers() const;
 };
 
 // Draw-without-replacement deck for unique special spawn rate control.
@@ -229,6 +240,12 @@ class overmapbuffer
          * Creates a new overmap if necessary.
          */
         const oter_id &ter( const tripoint_abs_omt &p );
+        /**
+         * Returns the sum of the monster density of the overmap terrain within
+         * @p radius (a square) of @p p, on the same z-level.
+         * Creates new overmaps if necessary.
+         */
+        int mondensity_sum( const tripoint_abs_omt &p, int radius );
         /**
          * Returns the overmap terrain at the given OMT coordinates.
          * Returns ot_null if the point is not in any existing overmap.
@@ -441,8 +458,19 @@ class overmapbuffer
         bool reveal( const tripoint_abs_omt &center, int radius );
         bool reveal( const tripoint_abs_omt &center, int radius,
                      const std::function<bool( const oter_id & )> &filter );
+        /**
+         * Find the cheapest overmap route from @p src to @p dest.  Recent results
+         * are cached until the overmap changes in a way that could affect them,
+         * see @ref travel_costs_changed.
+         */
         pf::simple_path<tripoint_abs_omt> get_travel_path(
             const tripoint_abs_omt &src, const tripoint_abs_omt &dest, const overmap_path_params &params );
+        /**
+         * Drop cached travel paths that might be affected by a change of the overmap.
+         * @param terrain true if terrain changed, false if only the player's knowledge
+         * of the overmap (seen tiles, dangerous notes) changed.
+         */
+        void travel_costs_changed( bool terrain );
         bool reveal_route( const tripoint_abs_omt &source, const tripoint_abs_omt &dest,
                            int radius = 0, bool road_only = false );
         /**
@@ -490,6 +518,14 @@ class overmapbuffer
          * (x,y) are global overmap coordinates (same as @ref get).
          */
         overmap *get_existing( const point_abs_om &p );
+        /**
+         * Load or generate at most one overmap that is within @p margin overmap
+         * terrains of @p center and isn't in the buffer yet, nearest first.
+         * Meant to be called when a pause won't be noticed, so that the overmaps
+         * the player is heading towards are ready before they are needed.
+         * @returns true if an overmap was loaded or generated.
+         */
+        bool prepare_overmap_near( const tripoint_abs_omt &center, int margin );
         /**
          * Returns whether or not the location has been generated (e.g. mapgen has run).
          * @param loc is in world-global omt coordinates.
@@ -667,7 +703,8 @@ class overmapbuffer
          * @param location Location of search
          * see omt_find_params for definitions of the terms
          */
-        bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params );
+        bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params,
+                                   const std::vector<const oter_matcher *> &matchers );
 
         std::unordered_map< point_abs_om, std::unique_ptr< overmap > > overmaps;
         /**
@@ -678,6 +715,20 @@ class overmapbuffer
         // Cached result of previous call to overmapbuffer::get_existing
         overmap mutable *last_requested_overmap;
 
+        struct cached_travel_path {
+            tripoint_abs_omt src;
+            tripoint_abs_omt dest;
+            overmap_path_params params;
+            int terrain_version;
+            int knowledge_version;
+            pf::simple_path<tripoint_abs_omt> path;
+        };
+        // Recent results of get_travel_path, oldest first.
+        std::vector<cached_travel_path> travel_path_cache;
+        // Bumped by travel_costs_changed() to tell which cached paths are still valid.
+        int travel_terrain_version = 0;
+        int travel_knowledge_version = 0;
+
         /**
          * Get a list of notes in the (loaded) overmaps.
          * @param z only this specific z-level is search for notes.
@@ -698,8 +749,7 @@ class overmapbuffer
          * overmap terrain coordinates.
          * This function may create a new overmap if needed.
          */
-        bool check_ot( const std::string &otype, ot_match_type match_type,
-                       const tripoint_abs_omt &p );
+        bool check_ot( const oter_matcher &matcher, const tripoint_abs_omt &p );
         bool check_overmap_special_type( const overmap_special_id &id, const tripoint_abs_omt &loc );
         std::optional<overmap_special_id> overmap_special_at( const tripoint_abs_omt & );
         std::optional<mapgen_arguments> get_existing_omt_stack_arguments( const point_abs_omt &p );
@@ -708,8 +758,7 @@ class overmapbuffer
         * These versions of the check_* methods will only check existing overmaps, and
         * return false if the overmap doesn't exist. They do not create new overmaps.
         */
-        bool check_ot_existing( const std::string &otype, ot_match_type match_type,
-                                const tripoint_abs_omt &loc );
+        bool check_ot_existing( const oter_matcher &matcher, const tripoint_abs_omt &loc );
         bool check_overmap_special_type_existing( const overmap_special_id &id,
                 const tripoint_abs_omt &loc );
 
@@ -11,3 +11,31 @@ std::vector<cata_timer::timers_map::iterator> &cata_timer::timer_stack()
     static std::vector<cata_timer::timers_map::iterator> stack;
     return stack;
 }
+
+std::map<std::string, cata_cache_stats, std::less<>> &cata_cache_stats::stats_map()
+{
+    static std::map<std::string, cata_cache_stats, std::less<>> map;
+    return map;
+}
+
+cata_cache_stats &cata_cache_stats::get( std::string_view name )
+{
+    std::map<std::string, cata_cache_stats, std::less<>> &map = stats_map();
+    auto it = map.find( name );
+    if( it == map.end() ) {
+        it = map.emplace( name, cata_cache_stats{ name } ).first;
+    }
+    return it->second;
+}
+
+void cata_cache_stats::print_stats()
+{
+    for( const auto& [name, stats] : stats_map() ) {
+        const uint64_t lookups = stats.hits + stats.misses;
+        if( lookups == 0 ) {
+            continue;
+        }
+        DebugLog( DebugLevel::D_WARNING, D_MAIN ) << name << ": " << stats.hits << " hits, " <<
+                stats.misses << " misses (" << stats.hits * 100 / lookups << "% hit rate)";
+    }
+}
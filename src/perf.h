@@ -80,4 +80,21 @@ struct cata_timer {
         static std::vector<timers_map::iterator> &timer_stack();
 };
 
+// Hit and miss counts of a cache.  Callers keep the reference returned by get()
+// and bump the counts directly, so counting costs no more than an increment.
+struct cata_cache_stats {
+        std::string name;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        explicit cata_cache_stats( std::string_view name ) : name{ name } {}
+
+        // The counts registered under name.  References stay valid for the whole run.
+        static cata_cache_stats &get( std::string_view name );
+
+        static void print_stats();
+    private:
+        static std::map<std::string, cata_cache_stats, std::less<>> &stats_map();
+};
+
 #endif // CATA_SRC_PERF_H
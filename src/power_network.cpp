@@ -75,6 +75,25 @@ void power_network_manager::clear()
 {
     networks_.clear();
     next_id_ = 1;
+    invalidate_topology();
+}
+
+const std::map<vehicle *, float> *power_network_manager::find_cached_grid(
+    const vehicle *start ) const
+{
+    const auto it = topology_cache_.find( start );
+    return it == topology_cache_.end() ? nullptr : &it->second;
+}
+
+const std::map<vehicle *, float> &power_network_manager::cache_grid( const vehicle *start,
+        std::map<vehicle *, float> grid )
+{
+    return topology_cache_[start] = std::move( grid );
+}
+
+void power_network_manager::invalidate_topology()
+{
+    topology_cache_.clear();
 }
 
 static power_network_node make_node_from_vehicle( const vehicle &veh )
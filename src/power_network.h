@@ -46,9 +46,23 @@ struct power_network {
 // Owns all power networks. Rebuilt every turn from search_connected_vehicles(),
 // carrying forward id from predecessor networks matched by position overlap.
 // last_resolved is set to calendar::turn on each rebuild.
+//
+// Also caches the cable topology of the reality bubble: the result of walking
+// the grid from a vehicle is kept until the topology is invalidated, which
+// happens whenever vehicle parts change or vehicles are added to, moved within
+// or removed from the map.
 class power_network_manager
 {
     public:
+        // Cached result of vehicle::search_connected_vehicles() started from
+        // start, or nullptr if the grid has not been walked since the last
+        // invalidation.
+        const std::map<vehicle *, float> *find_cached_grid( const vehicle *start ) const;
+        const std::map<vehicle *, float> &cache_grid( const vehicle *start,
+                std::map<vehicle *, float> grid );
+        // Drops all cached grid topology.
+        void invalidate_topology();
+
         // Call begin_rebuild() before adding grids each turn.
         // Call add_grid() for each BFS-discovered grid.
         // Call finish_rebuild() after all grids have been added.
@@ -76,6 +90,10 @@ class power_network_manager
         std::unordered_set<int> claimed_ids_; // NOLINT(cata-serialize)
         std::map<int, power_network> pending_networks_; // NOLINT(cata-serialize)
         int rebuild_next_id_ = 1; // NOLINT(cata-serialize)
+
+        // Cached grid walks, keyed by the start vehicle.
+        std::unordered_map<const vehicle *, std::map<vehicle *, float>>
+                topology_cache_; // NOLINT(cata-serialize)
 };
 
 #endif // CATA_SRC_POWER_NETWORK_H
@@ -31,6 +31,8 @@ struct omt_types_parameters {
     std::string omt;
     ot_match_type omt_type;
     std::unordered_map<std::string, std::unordered_set<std::string>> parameters;
+    // omt and omt_type, resolved on load
+    const oter_matcher *matcher = nullptr;
 };
 
 struct recipe_group_data {
@@ -74,7 +76,8 @@ void recipe_group_data::load( const JsonObject &jo, std::string_view )
                     jo.read( "parameters", parameter_map );
                 }
             }
-            om_terrains[name_id].emplace_back( omt_types_parameters{ ter, ter_match_type, parameter_map } );
+            om_terrains[name_id].emplace_back( omt_types_parameters{ ter, ter_match_type, parameter_map,
+                                               &oter_matcher::get( ter, ter_match_type ) } );
         }
     }
 }
@@ -146,7 +149,7 @@ std::map<recipe_id, translation> recipe_group::get_recipes_by_id( const std::str
                 all_rec.emplace( recp );
                 break;
             }
-            if( !is_ot_match( om_terrain.omt, omt_ter, om_terrain.omt_type ) ) {
+            if( !om_terrain.matcher->matches( omt_ter ) ) {
                 continue;
             }
             if( om_terrain.parameters.empty() ) {
@@ -16,6 +16,7 @@
 #include "mapdata.h"
 #include "map_extras.h"
 #include "omdata.h"
+#include "overmap.h"
 #include "rng.h"
 #include "string_formatter.h"
 
@@ -500,6 +501,7 @@ void shore_extendable_overmap_terrain_alias::deserialize( const JsonObject &jo )
     optional( jo, false, "om_terrain", overmap_terrain );
     optional( jo, false, "alias", alias );
     optional( jo, false, "om_terrain_match_type", match_type );
+    matcher = &oter_matcher::get( overmap_terrain, match_type );
 }
 
 void region_settings_river::load( const JsonObject &jo, std::string_view )
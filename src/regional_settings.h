@@ -23,6 +23,7 @@ class weather_generator;
 class JsonObject;
 class JsonValue;
 class mapgendata;
+class oter_matcher;
 
 const region_settings_id DEFAULT_REGION( "default" );
 
@@ -244,6 +245,8 @@ struct region_settings_forest {
 struct shore_extendable_overmap_terrain_alias {
     std::string overmap_terrain;
     ot_match_type match_type = ot_match_type::exact;
+    // overmap_terrain and match_type, resolved on load
+    const oter_matcher *matcher = nullptr;
     oter_str_id alias;
     void deserialize( const JsonObject &jo );
 };
@@ -2063,7 +2063,9 @@ void faction_manager::deserialize( const JsonValue &jv )
 void creature_tracker::deserialize( const JsonArray &ja )
 {
     monsters_list.clear();
+    ++list_generation_;
     monsters_by_location.clear();
+    monsters_by_submap.clear();
     for( JsonValue jv : ja ) {
         // TODO: would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
         shared_ptr_fast<monster> mptr = make_shared_fast<monster>();
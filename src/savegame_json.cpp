@@ -3304,9 +3304,9 @@ void item::io( Archive &archive )
     if( savegame_loading_version < 36 ) {
         const std::string prefix = "npctalk_var_";
         for( auto i = item_vars.begin(); i != item_vars.end(); ) {
-            if( i->first.rfind( prefix, 0 ) == 0 ) {
+            if( i->first.str().rfind( prefix, 0 ) == 0 ) {
                 global_variables::impl_t::node_type extracted = ( *item_vars ).extract( i++ );
-                std::string new_key = extracted.key().substr( prefix.size() );
+                std::string new_key = extracted.key().str().substr( prefix.size() );
                 extracted.key() = new_key;
                 item_vars.insert( std::move( extracted ) );
             } else {
@@ -3487,7 +3487,7 @@ void item::io( Archive &archive )
     // counter, it will always be 0 and it prevents proper stacking.
     if( get_chapters() == 0 ) {
         for( auto it = item_vars.begin(); it != item_vars.end(); ) {
-            if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
+            if( it->first.str().compare( 0, 19, "remaining-chapters-" ) == 0 ) {
                 item_vars.erase( it++ );
             } else {
                 ++it;
@@ -4445,45 +4445,49 @@ void player_morale::load( const JsonObject &jsin )
 
 void mm_submap::serialize( JsonOut &jsout ) const
 {
+    // Saved as [ palette, tiles ]. Palette holds the distinct tiles in use,
+    // tiles is a RLE sequence of [ count, palette index ] pairs.
     jsout.start_array();
 
-    // Uses RLE for compression.
-
-    memorized_tile last;
-    int num_same = 1;
-
-    const auto write_seq = [&]() {
+    std::vector<int> remap( palette.size(), -1 );
+    jsout.start_array();
+    int num_used = 0;
+    for( size_t i = 0; i < palette.size(); i++ ) {
+        if( palette_uses[i] == 0 ) {
+            continue;
+        }
+        remap[i] = num_used++;
+        const memorized_tile &mt = palette[i];
         jsout.start_array();
-        jsout.write( num_same );
-        jsout.write( static_cast<int>( last.symbol ) );
-        jsout.write( last.ter_id );
-        jsout.write( static_cast<int>( last.ter_subtile ) );
-        jsout.write( static_cast<int>( last.ter_rotation ) );
-        if( !last.get_dec_id().empty() ) {
-            jsout.write( last.dec_id );
-            jsout.write( static_cast<int>( last.dec_subtile ) );
-            jsout.write( static_cast<int>( last.dec_rotation ) );
+        jsout.write( static_cast<int>( mt.symbol ) );
+        jsout.write( mt.ter_id );
+        jsout.write( static_cast<int>( mt.ter_subtile ) );
+        jsout.write( static_cast<int>( mt.ter_rotation ) );
+        if( !mt.get_dec_id().empty() ) {
+            jsout.write( mt.get_dec_id() );
+            jsout.write( static_cast<int>( mt.dec_subtile ) );
+            jsout.write( static_cast<int>( mt.dec_rotation ) );
         }
         jsout.end_array();
-    };
+    }
+    jsout.end_array();
 
-    for( size_t y = 0; y < SEEY; y++ ) {
-        for( size_t x = 0; x < SEEX; x++ ) {
-            const memorized_tile &elem = get_tile( point_sm_ms( x, y ) );
-            if( x == 0 && y == 0 ) {
-                last = elem;
-                continue;
-            }
-            if( last == elem ) {
-                num_same += 1;
-                continue;
-            }
-            write_seq();
-            num_same = 1;
-            last = elem;
+    jsout.start_array();
+    uint8_t last = tiles.front();
+    int num_same = 0;
+    for( const uint8_t idx : tiles ) {
+        if( idx == last ) {
+            num_same += 1;
+            continue;
         }
+        jsout.write( num_same );
+        jsout.write( remap[last] );
+        num_same = 1;
+        last = idx;
     }
-    write_seq();
+    jsout.write( num_same );
+    jsout.write( remap[last] );
+    jsout.end_array();
 
     jsout.end_array();
 }
@@ -4498,6 +4502,44 @@ static std::string migrate_memorized_terrain( const std::string &ter_id )
 
 void mm_submap::deserialize( int version, const JsonArray &ja )
 {
+    if( version >= 2 ) {
+        allocate_tiles();
+        palette.clear();
+        for( JsonArray ja_tile : ja.get_array( 0 ) ) {
+            memorized_tile &tile = palette.emplace_back();
+            tile.symbol = ja_tile.get_int( 0 );
+            tile.set_ter_id( migrate_memorized_terrain( ja_tile.get_string( 1 ) ) );
+            tile.ter_subtile = ja_tile.get_int( 2 );
+            tile.ter_rotation = ja_tile.get_int( 3 );
+            if( ja_tile.size() > 4 ) {
+                tile.set_dec_id( ja_tile.get_string( 4 ) );
+                tile.dec_subtile = ja_tile.get_int( 5 );
+                tile.dec_rotation = ja_tile.get_int( 6 );
+            }
+        }
+        if( palette.empty() || palette.size() > SEEX * SEEY ) {
+            ja.throw_error( "invalid map memory palette size" );
+        }
+        palette_uses.assign( palette.size(), 0 );
+        JsonArray ja_tiles = ja.get_array( 1 );
+        size_t pos = 0;
+        while( ja_tiles.has_more() ) {
+            const int count = ja_tiles.next_int();
+            const int idx = ja_tiles.next_int();
+            if( count < 1 || pos + count > tiles.size() || idx < 0 ||
+                static_cast<size_t>( idx ) >= palette.size() ) {
+                ja.throw_error( "invalid map memory tile sequence" );
+            }
+            std::fill_n( tiles.begin() + pos, count, static_cast<uint8_t>( idx ) );
+            palette_uses[idx] += count;
+            pos += count;
+        }
+        if( pos != tiles.size() ) {
+            ja.throw_error( "incomplete map memory tile sequence" );
+        }
+        return;
+    }
+
     size_t submap_array_idx = 0;
 
     // Uses RLE for compression.
@@ -4526,7 +4568,7 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
                         tile.set_dec_id( std::move( id ) );
                         tile.set_dec_subtile( ja_tile.get_int( 1 ) );
                         const int legacy_rotation = ja_tile.get_int( 2 );
-                        if( string_starts_with( tile.dec_id, "vp_" ) ) {
+                        if( string_starts_with( tile.get_dec_id(), "vp_" ) ) {
                             // legacy vehicle rotation needs to be converted from 0-360 degrees
                             // to 0-3 tileset rotation
                             const units::angle legacy_angle = units::from_degrees( legacy_rotation );
@@ -4567,7 +4609,7 @@ void mm_submap::deserialize( int version, const JsonArray &ja )
 void mm_region::serialize( JsonOut &jsout ) const
 {
     jsout.start_object();
-    jsout.member( "version", 1 );
+    jsout.member( "version", 2 );
     jsout.write( "data" );
     jsout.write_member_separator();
     jsout.start_array();
@@ -5083,6 +5125,7 @@ void event_multiset::deserialize( const JsonObject &jo )
         jo.read( "event_counts", copy );
         summaries_ = { copy.begin(), copy.end() };
     }
+    index_.built = false;
 }
 
 void stats_tracker::serialize( JsonOut &jsout ) const
@@ -5100,6 +5143,10 @@ void stats_tracker::deserialize( const JsonObject &jo )
     for( std::pair<const event_type, event_multiset> &d : data ) {
         d.second.set_type( d.first );
     }
+    // Bring any states already tracking these events up to date
+    for( const auto &p : event_type_watchers ) {
+        p.second.send_to_all( &event_multiset_watcher::events_reset, get_events( p.first ), *this );
+    }
     jo.read( "initial_scores", initial_scores );
 
     // TODO: remove after 0.H
@@ -123,12 +123,13 @@ void omt_types_parameters::deserialize( const JsonValue &jv )
     if( jv.test_string() ) {
         jv.read( omt, true );
         omt_type = ot_match_type::type;
-        return;
+    } else {
+        JsonObject jo = jv.get_object();
+        mandatory( jo, false, "om_terrain", omt );
+        optional( jo, false, "om_terrain_match_type", omt_type, ot_match_type::type );
+        optional( jo, false, "parameters", parameters );
     }
-    JsonObject jo = jv.get_object();
-    mandatory( jo, false, "om_terrain", omt );
-    optional( jo, false, "om_terrain_match_type", omt_type, ot_match_type::type );
-    optional( jo, false, "parameters", parameters );
+    matcher = &oter_matcher::get( omt, omt_type );
 }
 
 void start_location::load( const JsonObject &jo, const std::string_view )
@@ -320,7 +321,7 @@ std::pair<tripoint_abs_omt, std::unordered_map<std::string, std::string>>
                 continue;
             }
             auto target_is_ot_match = [&]( const omt_types_parameters & target ) {
-                return is_ot_match( target.omt, omap.ter( p ), target.omt_type );
+                return target.matcher->matches( omap.ter( p ) );
             };
             auto it = std::find_if( _locations.begin(), _locations.end(),
                                     target_is_ot_match );
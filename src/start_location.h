@@ -18,6 +18,7 @@
 class JsonObject;
 class JsonValue;
 class avatar;
+class oter_matcher;
 class tinymap;
 enum class ot_match_type : int;
 struct city;
@@ -32,6 +33,8 @@ struct omt_types_parameters {
     std::string omt;
     ot_match_type omt_type;
     std::unordered_map<std::string, std::string> parameters;
+    // omt and omt_type, resolved on load
+    const oter_matcher *matcher = nullptr;
 
     void deserialize( const JsonValue &jv );
 };
@@ -188,12 +188,29 @@ std::optional<event_multiset::summaries_type::value_type> event_multiset::last()
 
 void event_multiset::add( const cata::event &e )
 {
-    summaries_[e.data()].add( e );
+    if( !index_.built ) {
+        index_.by_hash.clear();
+        for( summaries_type::value_type &entry : summaries_ ) {
+            index_.by_hash[cata::event::data_hash( entry.first )].push_back( &entry );
+        }
+        index_.built = true;
+    }
+    std::vector<summaries_type::value_type *> &candidates = index_.by_hash[e.hash()];
+    for( summaries_type::value_type *entry : candidates ) {
+        if( e.data_equals( entry->first ) ) {
+            entry->second.add( e );
+            return;
+        }
+    }
+    summaries_type::value_type &entry = *summaries_.emplace( e.data(), event_summary() ).first;
+    entry.second.add( e );
+    candidates.push_back( &entry );
 }
 
 void event_multiset::add( const summaries_type::value_type &e )
 {
     summaries_[e.first].add( e.second );
+    index_.built = false;
 }
 
 base_watcher::~base_watcher()
@@ -240,11 +257,28 @@ event_multiset &stats_tracker::get_events( event_type type )
 event_multiset stats_tracker::get_events(
     const string_id<event_transformation> &transform_id )
 {
+    auto it = event_transformation_states.find( transform_id );
+    if( it != event_transformation_states.end() && notify_depth == 0 ) {
+        return static_cast<const stats_tracker_multiset_state &>( *it->second ).get_events();
+    }
     return transform_id->value( *this );
 }
 
 cata_variant stats_tracker::value_of( const string_id<event_statistic> &stat )
 {
+    // The states are kept up to date as events arrive, so once a statistic
+    // has been asked for it can be answered without rescanning its events.
+    auto it = stat_states.find( stat );
+    if( it != stat_states.end() ) {
+        if( notify_depth == 0 ) {
+            return it->second->get_value();
+        }
+    } else if( notify_depth == 0 ) {
+        std::unique_ptr<stats_tracker_state> state = stat->watch( *this );
+        const cata_variant value = state->get_value();
+        stat_states.emplace( stat, std::move( state ) );
+        return value;
+    }
     return stat->value( *this );
 }
 
@@ -367,7 +401,9 @@ void stats_tracker::notify( const cata::event &e )
 
     auto it = event_type_watchers.find( type );
     if( it != event_type_watchers.end() ) {
+        ++notify_depth;
         it->second.send_to_all( &event_multiset_watcher::event_added, e, *this );
+        --notify_depth;
     }
 
     if( e.type() == event_type::game_start ) {
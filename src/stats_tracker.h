@@ -100,8 +100,25 @@ class event_multiset
         void serialize( JsonOut & ) const;
         void deserialize( const JsonObject &jo );
     private:
+        // Entries of summaries_ by cata::event::hash, so that an event can find
+        // its entry without building its data map.  Rebuilt on demand; copies
+        // start out unbuilt since the pointers refer to the original's entries.
+        struct summary_index {
+            summary_index() = default;
+            summary_index( const summary_index & ) {}
+            summary_index &operator=( const summary_index & ) {
+                by_hash.clear();
+                built = false;
+                return *this;
+            }
+
+            std::unordered_map<size_t, std::vector<summaries_type::value_type *>> by_hash;
+            bool built = false;
+        };
+
         event_type type_; // NOLINT(cata-serialize)
         summaries_type summaries_;
+        summary_index index_; // NOLINT(cata-serialize)
 };
 
 class base_watcher
@@ -182,6 +199,7 @@ class stats_tracker_multiset_state : public stats_tracker_state
 {
     public:
         [[noreturn]] const cata_variant &get_value() const override;
+        virtual const event_multiset &get_events() const = 0;
 };
 
 class stats_tracker : public event_subscriber
@@ -222,6 +240,11 @@ class stats_tracker : public event_subscriber
 
         std::unordered_map<event_type, event_multiset> data;
 
+        // Depth of nested calls to notify.  While an event is being delivered
+        // the states may not all have seen it yet, so queries made then are
+        // computed from the events directly.
+        int notify_depth = 0; // NOLINT(cata-serialize)
+
         // NOLINTNEXTLINE(cata-serialize)
         std::unordered_map<event_type, watcher_set<event_multiset_watcher>> event_type_watchers;
         std::unordered_map<string_id<event_transformation>, watcher_set<event_multiset_watcher>>
@@ -574,17 +574,17 @@ void talker_character::remove_effect( const efftype_id &old_effect, const std::s
     me_chr->remove_effect( old_effect, target_part );
 }
 
-diag_value const *talker_character_const::maybe_get_value( const std::string &var_name ) const
+diag_value const *talker_character_const::maybe_get_value( const var_key &var_name ) const
 {
     return me_chr_const->maybe_get_value( var_name );
 }
 
-void talker_character::set_value( const std::string &var_name, diag_value const &value )
+void talker_character::set_value( const var_key &var_name, diag_value const &value )
 {
     me_chr->set_value( var_name, value );
 }
 
-void talker_character::remove_value( const std::string &var_name )
+void talker_character::remove_value( const var_key &var_name )
 {
     me_chr->remove_value( var_name );
 }
@@ -111,7 +111,7 @@ class talker_character_const: virtual public const_talker
                               const bp_type &bp = bp_type::num_types ) const override;
         bool is_deaf() const override;
         bool is_mute() const override;
-        diag_value const *maybe_get_value( const std::string &var_name ) const override;
+        diag_value const *maybe_get_value( const var_key &var_name ) const override;
 
         // stats, skills, traits, bionics, magic, and proficiencies
         std::vector<skill_id> skills_teacheable() const override;
@@ -280,8 +280,8 @@ class talker_character: virtual public talker
                          const std::string &bp, bool permanent, bool force, int intensity
                        ) override;
         void remove_effect( const efftype_id &old_effect, const std::string &bp ) override;
-        void set_value( const std::string &var_name, diag_value const &value ) override;
-        void remove_value( const std::string &var_name ) override;
+        void set_value( const var_key &var_name, diag_value const &value ) override;
+        void remove_value( const var_key &var_name ) override;
 
         // inventory, buying, and selling
         std::list<item> use_charges( const itype_id &item_name, int count ) override;
@@ -59,7 +59,7 @@ tripoint_abs_omt talker_item_const::pos_abs_omt() const
     return get_player_character().pos_abs_omt();
 }
 
-diag_value const *talker_item_const::maybe_get_value( const std::string &var_name ) const
+diag_value const *talker_item_const::maybe_get_value( const var_key &var_name ) const
 {
     return me_it_const->get_item()->maybe_get_value( var_name );
 }
@@ -148,12 +148,12 @@ int talker_item_const::get_quality( const std::string &quality, bool strict ) co
     return me_it_const->get_quality( quality, strict );
 }
 
-void talker_item::set_value( const std::string &var_name, diag_value const &value )
+void talker_item::set_value( const var_key &var_name, diag_value const &value )
 {
     me_it->get_item()->set_var( var_name, value );
 }
 
-void talker_item::remove_value( const std::string &var_name )
+void talker_item::remove_value( const var_key &var_name )
 {
     me_it->get_item()->erase_var( var_name );
 }
@@ -40,7 +40,7 @@ class talker_item_const: public const_talker_cloner<talker_item_const>
         tripoint_abs_ms pos_abs() const override;
         tripoint_abs_omt pos_abs_omt() const override;
 
-        diag_value const *maybe_get_value( const std::string &var_name ) const override;
+        diag_value const *maybe_get_value( const var_key &var_name ) const override;
 
         bool has_flag( const flag_id &f ) const override;
 
@@ -83,8 +83,8 @@ class talker_item: public talker_item_const, public talker_cloner<talker_item>
             return me_it;
         }
 
-        void set_value( const std::string &var_name, diag_value const &value ) override;
-        void remove_value( const std::string & ) override;
+        void set_value( const var_key &var_name, diag_value const &value ) override;
+        void remove_value( const var_key & ) override;
 
         void set_power_cur( units::energy value ) override;
         void set_all_parts_hp_cur( int ) override;
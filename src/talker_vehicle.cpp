@@ -55,17 +55,17 @@ tripoint_abs_omt talker_vehicle_const::pos_abs_omt() const
     return me_veh_const->pos_abs_omt();
 }
 
-diag_value const *talker_vehicle_const::maybe_get_value( const std::string &var_name ) const
+diag_value const *talker_vehicle_const::maybe_get_value( const var_key &var_name ) const
 {
     return me_veh_const->maybe_get_value( var_name );
 }
 
-void talker_vehicle::set_value( const std::string &var_name, diag_value const &value )
+void talker_vehicle::set_value( const var_key &var_name, diag_value const &value )
 {
     me_veh->set_value( var_name, value );
 }
 
-void talker_vehicle::remove_value( const std::string &var_name )
+void talker_vehicle::remove_value( const var_key &var_name )
 {
     me_veh->remove_value( var_name );
 }
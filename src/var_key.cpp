@@ -0,0 +1,54 @@
+#include "var_key.h"
+
+#include <deque>
+#include <unordered_map>
+
+namespace
+{
+struct var_key_table {
+    var_key_table() {
+        names.emplace_back();
+        ids.emplace( names.back(), 0 );
+    }
+
+    // A deque so that the views in ids stay valid as names are added
+    std::deque<std::string> names;
+    std::unordered_map<std::string_view, int> ids;
+};
+
+var_key_table &get_var_key_table()
+{
+    static var_key_table table;
+    return table;
+}
+} // namespace
+
+var_key::var_key( std::string_view name )
+{
+    var_key_table &table = get_var_key_table();
+    auto it = table.ids.find( name );
+    if( it != table.ids.end() ) {
+        id_ = it->second;
+        return;
+    }
+    id_ = static_cast<int>( table.names.size() );
+    table.names.emplace_back( name );
+    table.ids.emplace( table.names.back(), id_ );
+}
+
+std::optional<var_key> var_key::find( std::string_view name )
+{
+    const var_key_table &table = get_var_key_table();
+    const auto it = table.ids.find( name );
+    if( it == table.ids.end() ) {
+        return std::nullopt;
+    }
+    var_key ret;
+    ret.id_ = it->second;
+    return ret;
+}
+
+const std::string &var_key::str() const
+{
+    return get_var_key_table().names[id_];
+}
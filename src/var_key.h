@@ -0,0 +1,107 @@
+#pragma once
+#ifndef CATA_SRC_VAR_KEY_H
+#define CATA_SRC_VAR_KEY_H
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// The name of a dialogue variable, as used by global_variables and the
+// per-creature, per-item and per-vehicle variable stores.
+// Each distinct name is interned into a global table on first use, so the
+// stores hash and compare a dense integer instead of the whole string.  Ids
+// are only meaningful within one run of the game; save files keep the names.
+class var_key
+{
+    public:
+        var_key() = default;
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key( std::string_view name );
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key( const std::string &name ) : var_key( std::string_view( name ) ) {}
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key( const char *name ) : var_key( std::string_view( name ) ) {}
+
+        const std::string &str() const;
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        operator const std::string &() const {
+            return str();
+        }
+
+        int id() const {
+            return id_;
+        }
+        bool empty() const {
+            return id_ == 0;
+        }
+
+        // For use as a json object key
+        std::string to_string_writable() const {
+            return str();
+        }
+        static var_key from_string( const std::string &name ) {
+            return var_key( name );
+        }
+        // The key of name if it was interned before, without interning it otherwise
+        static std::optional<var_key> find( std::string_view name );
+
+        friend bool operator==( const var_key &l, const var_key &r ) {
+            return l.id_ == r.id_;
+        }
+        friend bool operator!=( const var_key &l, const var_key &r ) {
+            return l.id_ != r.id_;
+        }
+        // Orders by name, so that sorted output does not depend on the order
+        // in which names were interned
+        friend bool operator<( const var_key &l, const var_key &r ) {
+            return l.id_ != r.id_ && l.str() < r.str();
+        }
+
+    private:
+        // 0 is the empty name
+        int id_ = 0;
+};
+
+// A variable name that is only looked up.  Built from a string it finds the name
+// among those already interned rather than adding it, so asking about a variable
+// that was never set does not grow the table.  Hot call sites should still pass
+// a static var_key, which skips the lookup of the name altogether.
+class var_key_view
+{
+    public:
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key_view( const var_key &key ) : key_( key ) {}
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key_view( std::string_view name ) : key_( var_key::find( name ) ) {}
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key_view( const std::string &name ) : var_key_view( std::string_view( name ) ) {}
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        var_key_view( const char *name ) : var_key_view( std::string_view( name ) ) {}
+
+        // Empty if no variable of this name can exist
+        const std::optional<var_key> &key() const {
+            return key_;
+        }
+
+    private:
+        std::optional<var_key> key_;
+};
+
+inline const std::string &format_as( const var_key &k )
+{
+    return k.str();
+}
+
+namespace std
+{
+template <>
+struct hash<var_key> {
+    std::size_t operator()( const var_key &k ) const noexcept {
+        return std::hash<int> {}( k.id() );
+    }
+};
+} // namespace std
+
+#endif // CATA_SRC_VAR_KEY_H
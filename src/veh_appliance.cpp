@@ -283,7 +283,8 @@ static void draw_appliance_connections( vehicle *veh )
                   veh->part( 0 ) ).xy() ) + mid_tile_offset;
 
     // draw connections to other vehicles (jumper cable)
-    for( const auto &other_vehicle : veh->search_connected_vehicles( here ) ) {
+    std::map<vehicle *, float> scratch;
+    for( const auto &other_vehicle : veh->connected_vehicles( here, scratch ) ) {
         vehicle *that_veh = other_vehicle.first;
         point end = tilecontext->player_to_screen( that_veh->bub_part_pos( here,
                     that_veh->part( 0 ) ).xy() ) + mid_tile_offset;
@@ -341,7 +342,8 @@ std::string veh_app_interact::draw_info_imgui_header( map &here )
 
     // Battery power output
     units::power grid_flow = 0_W;
-    for( const std::pair<vehicle *const, float> &pair : veh->search_connected_vehicles( here ) ) {
+    std::map<vehicle *, float> scratch;
+    for( const std::pair<vehicle *const, float> &pair : veh->connected_vehicles( here, scratch ) ) {
         grid_flow += pair.first->net_battery_charge_rate( here, /* include_reactors = */ true );
     }
     // Always start printing this on its own line
@@ -71,6 +71,7 @@
 #include "pimpl.h"
 #include "player_activity.h"
 #include "pocket_type.h"
+#include "power_network.h"
 #include "proficiency.h"
 #include "ret_val.h"
 #include "rng.h"
@@ -82,6 +83,7 @@
 #include "translations.h"
 #include "units_utility.h"
 #include "value_ptr.h"
+#include "var_key.h"
 #include "veh_type.h"
 #include "vehicle_part_location.h"
 #include "vehicle_selector.h"
@@ -153,6 +155,8 @@ static const std::string flag_E_COMBUSTION( "E_COMBUSTION" );
 static const std::string flag_FLAT_TIRE( "FLAT_TIRE" );
 static const std::string flag_WIRING( "WIRING" );
 
+static const var_key var_tied_down_furniture( "tied_down_furniture" );
+
 //~ Name for an array of electronic power grid appliances, like batteries and solar panels
 static const translation power_grid_name = to_translation( "power grid" );
 
@@ -226,7 +230,7 @@ units::volume vehicle_stack::max_volume() const
 
 units::volume vehicle_stack::stored_volume() const
 {
-    if( vp.get_base().has_var( "tied_down_furniture" ) ) { // There's a furniture in the way!!
+    if( vp.get_base().has_var( var_tied_down_furniture ) ) { // There's a furniture in the way!!
         return max_volume();
     }
     units::volume ret = 0_ml;
@@ -1205,22 +1209,22 @@ int vehicle::power_to_energy_bat( const units::power power, const time_duration
 }
 
 // Methods for setting/getting misc key/value pairs.
-void vehicle::set_value( const std::string &key, diag_value value )
+void vehicle::set_value( const var_key &key, diag_value value )
 {
     values[ key ] = std::move( value );
 }
 
-void vehicle::remove_value( const std::string &key )
+void vehicle::remove_value( var_key_view key )
 {
-    values.erase( key );
+    global_variables::_common_remove_value( key, values );
 }
 
-diag_value const &vehicle::get_value( const std::string &key ) const
+diag_value const &vehicle::get_value( var_key_view key ) const
 {
     return global_variables::_common_get_value( key, values );
 }
 
-diag_value const *vehicle::maybe_get_value( const std::string &key ) const
+diag_value const *vehicle::maybe_get_value( var_key_view key ) const
 {
     return global_variables::_common_maybe_get_value( key, values );
 }
@@ -3837,7 +3841,8 @@ int64_t vehicle::fuel_left( map &here, const itype_id &ftype,
 {
     int64_t fl = 0;
     if( ftype == fuel_type_battery ) {
-        for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+        std::map<vehicle *, float> scratch;
+        for( const std::pair<vehicle *const, float> &pair : connected_vehicles( here, scratch ) ) {
             const vehicle &veh = *pair.first;
             const float loss = pair.second;
             for( const int part_idx : veh.batteries ) {
@@ -3905,7 +3910,8 @@ int vehicle::fuel_capacity( map &here, const itype_id &ftype ) const
 {
     if( ftype == fuel_type_battery ) { // batteries get special treatment due to power cables
         int64_t capacity = 0;
-        for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+        std::map<vehicle *, float> scratch;
+        for( const std::pair<vehicle *const, float> &pair : connected_vehicles( here, scratch ) ) {
             const vehicle &veh = *pair.first;
             for( const int part_idx : veh.batteries ) {
                 const vehicle_part &vp = veh.parts[part_idx];
@@ -5487,7 +5493,8 @@ std::pair<int, int> vehicle::connected_battery_power_level( const map &here ) co
     int total_epower_remaining = 0;
     int total_epower_capacity = 0;
 
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+    std::map<vehicle *, float> scratch;
+    for( const std::pair<vehicle *const, float> &pair : connected_vehicles( here, scratch ) ) {
         int epower_remaining;
         int epower_capacity;
         std::tie( epower_remaining, epower_capacity ) = pair.first->battery_power_level( );
@@ -5947,14 +5954,57 @@ void vehicle::translate_cables( const tripoint_rel_ms &offset )
     }
 }
 
+vehicle *vehicle::find_on_map( const map &here ) const
+{
+    // The map owns its vehicles, so even through a const map it hands out mutable ones.
+    for( const vehicle_part &vp : parts ) {
+        if( vp.removed || vp.is_fake ) {
+            continue;
+        }
+        const optional_vpart_position ovp = here.veh_at( abs_part_pos( vp ) );
+        if( ovp && &ovp->vehicle() == this ) {
+            return &ovp->vehicle();
+        }
+    }
+    return nullptr;
+}
+
+const std::map<vehicle *, float> &vehicle::cached_connected_vehicles( const map &here ) const
+{
+    // Grids in the reality bubble are walked once per topology change, see
+    // power_network_manager.
+    power_network_manager &pnm = g->power_networks();
+    if( const std::map<vehicle *, float> *grid = pnm.find_cached_grid( this ) ) {
+        return *grid;
+    }
+    vehicle *const self = find_on_map( here );
+    if( self == nullptr ) {
+        // Not (or no longer) part of the map, so not connected to anything on it either
+        static const std::map<vehicle *, float> no_grid;
+        return no_grid;
+    }
+    return pnm.cache_grid( this, search_connected_vehicles( here, self ) );
+}
+
 std::map<vehicle *, float> vehicle::search_connected_vehicles( const map &here )
 {
+    if( &here == &reality_bubble() ) {
+        return cached_connected_vehicles( here );
+    }
     return search_connected_vehicles( here, this );
 }
 
-std::map<const vehicle *, float> vehicle::search_connected_vehicles( const map &here ) const
+const std::map<vehicle *, float> &vehicle::connected_vehicles( const map &here,
+        std::map<vehicle *, float> &scratch ) const
 {
-    return search_connected_vehicles( here, this );
+    if( &here == &reality_bubble() ) {
+        return cached_connected_vehicles( here );
+    }
+    scratch.clear();
+    if( vehicle *const self = find_on_map( here ) ) {
+        scratch = search_connected_vehicles( here, self );
+    }
+    return scratch;
 }
 
 void vehicle::get_connected_vehicles( const map &here, std::unordered_set<vehicle *> &dest )
@@ -5980,7 +6030,8 @@ std::map<vpart_reference, float> vehicle::search_connected_batteries( map &here
 {
     std::map<vpart_reference, float> result;
 
-    for( const std::pair<vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+    std::map<vehicle *, float> scratch;
+    for( const std::pair<vehicle *const, float> &pair : connected_vehicles( here, scratch ) ) {
         vehicle *veh = pair.first;
         const float efficiency = pair.second;
         for( const int part_idx : veh->batteries ) {
@@ -6043,7 +6094,8 @@ static void distribute_charge_evenly( const std::map<vpart_reference, float> &ba
 
 bool vehicle::is_battery_available( map &here ) const
 {
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+    std::map<vehicle *, float> scratch;
+    for( const std::pair<vehicle *const, float> &pair : connected_vehicles( here, scratch ) ) {
         const vehicle &veh = *pair.first;
         for( const int part_idx : veh.batteries ) {
             const vehicle_part &vp = veh.parts[part_idx];
@@ -6058,7 +6110,8 @@ bool vehicle::is_battery_available( map &here ) const
 int64_t vehicle::battery_left( map &here, bool apply_loss ) const
 {
     int64_t ret = 0;
-    for( const std::pair<const vehicle *const, float> &pair : search_connected_vehicles( here ) ) {
+    std::map<vehicle *, float> scratch;
+    for( const std::pair<vehicle *const, float> &pair : connected_vehicles( here, scratch ) ) {
         const vehicle &veh = *pair.first;
         const float efficiency = 1.0f - ( apply_loss ? pair.second : 0.0f );
         for( const int part_idx : veh.batteries ) {
@@ -6770,6 +6823,11 @@ void vehicle::refresh( const bool remove_fakes )
         return;
     }
 
+    // Parts were added or removed, so the cables may have changed too.
+    if( g != nullptr ) {
+        g->power_networks().invalidate_topology();
+    }
+
     alternators.clear();
     engines.clear();
     reactors.clear();
@@ -8228,7 +8286,7 @@ bool vehicle::is_foldable() const
         return false;
     }
     for( const vehicle_part &vp : real_parts() ) {
-        if( vp.get_base().has_var( "tied_down_furniture" ) ) {
+        if( vp.get_base().has_var( var_tied_down_furniture ) ) {
             return false;
         }
         if( !vp.info().folded_volume ) {
@@ -8372,11 +8430,28 @@ const std::set<tripoint_abs_ms> &vehicle::get_points( const bool force_refresh,
             }
             occupied_points.insert( abs_part_pos( part_location.second.front() ) );
         }
+        const tripoint_abs_ms &first = occupied_points.empty() ? occupied_cache_pos :
+                                       *occupied_points.begin();
+        occupied_bounds = inclusive_cuboid<tripoint_abs_ms>( first, first );
+        for( const tripoint_abs_ms &p : occupied_points ) {
+            occupied_bounds.p_min = tripoint_abs_ms( std::min( occupied_bounds.p_min.x(), p.x() ),
+                                    std::min( occupied_bounds.p_min.y(), p.y() ),
+                                    std::min( occupied_bounds.p_min.z(), p.z() ) );
+            occupied_bounds.p_max = tripoint_abs_ms( std::max( occupied_bounds.p_max.x(), p.x() ),
+                                    std::max( occupied_bounds.p_max.y(), p.y() ),
+                                    std::max( occupied_bounds.p_max.z(), p.z() ) );
+        }
     }
 
     return occupied_points;
 }
 
+const inclusive_cuboid<tripoint_abs_ms> &vehicle::get_points_bounds() const
+{
+    get_points();
+    return occupied_bounds;
+}
+
 void vehicle::part_project_points( const tripoint_rel_ms &dp )
 {
     for( int p = 0; p < part_count(); p++ ) {
@@ -8563,9 +8638,10 @@ void vehicle::update_time( map &here, const time_point &update_to )
     if( funnels.empty() && solar_panels.empty() && wind_turbines.empty() && water_wheels.empty() ) {
         return;
     }
-    // Get one weather data set per vehicle, they don't differ much across vehicle area
-    const weather_sum accum_weather = sum_conditions( update_from, update_to,
-                                      pos_abs() );
+    // Get one weather data set per area, it doesn't differ much across it.  Vehicles
+    // parked together usually catch up over the same interval and share it.
+    const weather_sum accum_weather = get_weather().get_area_conditions( update_from, update_to,
+                                      pos_abs_omt() );
     // make some reference objects to use to check for reload
     const item water( itype_water );
     const item water_clean( itype_water_clean );
@@ -8673,7 +8749,8 @@ int vehicle::catchup_off_map_renewables( const time_point &now )
     last_update = now;
 
     int total_energy = 0;
-    const weather_sum accum_weather = sum_conditions( update_from, now, pos_abs() );
+    const weather_sum accum_weather = get_weather().get_area_conditions( update_from, now,
+                                      pos_abs_omt() );
 
     if( !solar_panels.empty() ) {
         units::power epower = 0_W;
@@ -8775,8 +8852,9 @@ void vehicle::calc_mass_center( map &here, bool use_precalc ) const
             m_part_items *= static_cast<float>( vp.part().info().cargo_weight_modifier ) / 100.0f;
         }
         if( vp.has_feature( "FURNITURE_TIEDOWN" ) &&
-            vp.part().get_base().has_var( "tied_down_furniture" ) ) {
-            furn_str_id carried_furniture( vp.part().get_base().get_var( "tied_down_furniture" ) );
+            vp.part().get_base().has_var( var_tied_down_furniture ) ) {
+            furn_str_id carried_furniture(
+                vp.part().get_base().get_var( var_tied_down_furniture ) );
             m_part_items += carried_furniture->mass;
         }
         m_part += m_part_items;
@@ -28,6 +28,7 @@
 #include "colony.h"
 #include "color.h"
 #include "coordinates.h"
+#include "cuboid_rectangle.h"
 #include "debug.h"
 #include "effect.h"
 #include "enums.h"
@@ -932,16 +933,20 @@ class vehicle
         /// Templated to support const and non-const vehicle*
         template<typename Vehicle>
         static std::map<Vehicle *, float> search_connected_vehicles( const map &here, Vehicle *start );
+        /// search_connected_vehicles() for the reality bubble, cached until the grid topology changes
+        const std::map<vehicle *, float> &cached_connected_vehicles( const map &here ) const;
+        /// This vehicle as owned by here, found through one of its parts; nullptr if it isn't there
+        vehicle *find_on_map( const map &here ) const;
     public:
         std::vector<std::string> chat_topics; // What it has to say.
-        void set_value( const std::string &key, diag_value value );
+        void set_value( const var_key &key, diag_value value );
         template <typename... Args>
-        void set_value( const std::string &key, Args... args ) {
+        void set_value( const var_key &key, Args... args ) {
             set_value( key, diag_value{ std::forward<Args>( args )... } );
         }
-        void remove_value( const std::string &key );
-        diag_value const &get_value( const std::string &key ) const;
-        diag_value const *maybe_get_value( const std::string &key ) const;
+        void remove_value( var_key_view key );
+        diag_value const &get_value( var_key_view key ) const;
+        diag_value const *maybe_get_value( var_key_view key ) const;
         void clear_values();
         void add_chat_topic( const std::string &topic );
         int get_passenger_count( bool hostile ) const;
@@ -969,8 +974,10 @@ class vehicle
         static vehicle *find_vehicle_using_parts( const map &here,  const tripoint_abs_ms &where );
         //! @copydoc vehicle::search_connected_vehicles( Vehicle *start )
         std::map<vehicle *, float> search_connected_vehicles( const map &here );
-        //! @copydoc vehicle::search_connected_vehicles( Vehicle *start )
-        std::map<const vehicle *, float> search_connected_vehicles( const map &here ) const;
+        /// As search_connected_vehicles(), without copying the result: in the reality bubble
+        /// this is the cached grid, on other maps the grid is walked into scratch.
+        const std::map<vehicle *, float> &connected_vehicles( const map &here,
+                std::map<vehicle *, float> &scratch ) const;
         //! @copydoc vehicle::search_connected_vehicles( Vehicle *start )
         void get_connected_vehicles( const map &here, std::unordered_set<vehicle *> &dest );
 
@@ -1934,6 +1941,11 @@ class vehicle
         // Returns collision, which has type, impulse, part, & target.
         veh_collision part_collision( map &here, int part, const tripoint_abs_ms &p,
                                       bool just_detect, bool bash_floor );
+        // Broadphase for collision(): whether there is no creature and no other vehicle
+        // anywhere in the box spanned by the projected positions of the non-rotor parts.
+        // The crew and monsters riding on this vehicle don't count, part_collision
+        // ignores them too.
+        bool projected_area_clear( const map &here ) const;
 
         // Probability that the wheel will hit the item.
         static double hit_probability( const item &it, const vehicle_part *vp_wheel );
@@ -2174,6 +2186,8 @@ class vehicle
         // Update the set of occupied points and return a reference to it
         const std::set<tripoint_abs_ms> &get_points( bool force_refresh = false,
                 bool no_fake = false ) const;
+        // Bounding box of the points returned by get_points()
+        const inclusive_cuboid<tripoint_abs_ms> &get_points_bounds() const;
 
         // calculate the new projected points for all vehicle parts to move to
         void part_project_points( const tripoint_rel_ms &dp );
@@ -2357,6 +2371,8 @@ class vehicle
         mutable units::angle occupied_cache_direction = 0_degrees; // NOLINT(cata-serialize)
         // Cached points occupied by the vehicle
         mutable std::set<tripoint_abs_ms> occupied_points; // NOLINT(cata-serialize)
+        // Bounding box of occupied_points
+        mutable inclusive_cuboid<tripoint_abs_ms> occupied_bounds; // NOLINT(cata-serialize)
 
         // Master list of parts installed in the vehicle.
         std::vector<vehicle_part> parts; // NOLINT(cata-serialize)
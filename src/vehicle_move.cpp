@@ -10,6 +10,7 @@
 #include <set>
 #include <tuple>
 
+#include "avatar.h"
 #include "bodypart.h"
 #include "cata_assert.h"
 #include "cata_utility.h"
@@ -32,6 +33,7 @@
 #include "material.h"
 #include "messages.h"
 #include "monster.h"
+#include "npc.h"
 #include "options.h"
 #include "rng.h"
 #include "sounds.h"
@@ -786,6 +788,9 @@ bool vehicle::collision( map &here, std::vector<veh_collision> &colls,
     const int sign_before = sgn( velocity_before );
     bool empty = true;
     part_project_points( dp );
+    // If nothing but terrain can be in the way, parts moving onto open, flat ground
+    // can't hit anything and the per-part check can be skipped for them.
+    const bool area_clear = !bash_floor && projected_area_clear( here );
     for( int p = 0; p < part_count(); p++ ) {
         const vehicle_part &vp = parts.at( p );
         if( vp.removed || !vp.is_real_or_active_fake() ) {
@@ -800,6 +805,13 @@ bool vehicle::collision( map &here, std::vector<veh_collision> &colls,
         // Coordinates of where part will go due to movement (dx/dy/dz)
         //  and turning (precalc[1])
         const tripoint_abs_ms dsp = vp.next_pos;
+        if( area_clear && !info.has_flag( VPFLAG_ROTOR ) ) {
+            const tripoint_bub_ms dsp_bub = here.get_bub( dsp );
+            // Movecost 2 is flat terrain like a floor, part_collision ignores it.
+            if( here.move_cost_ter_furn( dsp_bub ) == 2 && !here.impassable_field_at( dsp_bub ) ) {
+                continue;
+            }
+        }
         veh_collision coll = part_collision( here, p, dsp, just_detect, bash_floor );
         if( coll.type == veh_coll_nothing && info.has_flag( VPFLAG_ROTOR ) ) {
             size_t radius = static_cast<size_t>( std::round( info.rotor_info->rotor_diameter / 2.0f ) );
@@ -876,6 +888,76 @@ static void terrain_collision_data( map &here, const tripoint_bub_ms &p, bool ba
     density = bash_min;
 }
 
+bool vehicle::projected_area_clear( const map &here ) const
+{
+    std::optional<inclusive_cuboid<tripoint_abs_ms>> area;
+    for( const vehicle_part &vp : parts ) {
+        if( vp.removed || !vp.is_real_or_active_fake() || vp.info().has_flag( VPFLAG_ROTOR ) ) {
+            continue;
+        }
+        const tripoint_abs_ms &p = vp.next_pos;
+        if( !area ) {
+            area = inclusive_cuboid<tripoint_abs_ms>( p, p );
+        } else {
+            area->p_min = tripoint_abs_ms( std::min( area->p_min.x(), p.x() ),
+                                           std::min( area->p_min.y(), p.y() ),
+                                           std::min( area->p_min.z(), p.z() ) );
+            area->p_max = tripoint_abs_ms( std::max( area->p_max.x(), p.x() ),
+                                           std::max( area->p_max.y(), p.y() ),
+                                           std::max( area->p_max.z(), p.z() ) );
+        }
+    }
+    if( !area ) {
+        return true;
+    }
+    const auto on_this_vehicle = [&]( const tripoint_abs_ms & p ) {
+        optional_vpart_position ovp = here.veh_at( p );
+        if( ovp && &ovp->vehicle() != this ) {
+            ovp.reset();
+        }
+        return ovp;
+    };
+
+    creature_tracker &creatures = get_creature_tracker();
+    // Same as in part_collision, critters on a boardable part of this vehicle are riding along.
+    const auto in_the_way = [&]( const monster & critter ) {
+        const optional_vpart_position ovp = on_this_vehicle( critter.pos_abs() );
+        return !ovp || get_monster( here, ovp->part_index() ) == nullptr;
+    };
+    if( creatures.count_in_rect( area->p_min, area->p_max, in_the_way ) > 0 ) {
+        return false;
+    }
+    const auto character_in_the_way = [&]( const Character & guy ) {
+        return area->contains( guy.pos_abs() ) &&
+               !( guy.in_vehicle && on_this_vehicle( guy.pos_abs() ) );
+    };
+    if( character_in_the_way( get_avatar() ) ) {
+        return false;
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        if( character_in_the_way( guy ) ) {
+            return false;
+        }
+    }
+
+    for( int z = area->p_min.z(); z <= area->p_max.z(); z++ ) {
+        if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+            continue;
+        }
+        for( const vehicle *other : here.get_cache_ref( z ).vehicle_list ) {
+            if( other == this || !area->overlaps( other->get_points_bounds() ) ) {
+                continue;
+            }
+            for( const tripoint_abs_ms &p : other->get_points() ) {
+                if( area->contains( p ) ) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 veh_collision vehicle::part_collision( map &here, int part, const tripoint_abs_ms &p,
                                        bool just_detect, bool bash_floor )
 {
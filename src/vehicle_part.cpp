@@ -24,6 +24,7 @@
 #include "translations.h"
 #include "units.h"
 #include "value_ptr.h"
+#include "var_key.h"
 #include "veh_type.h"
 #include "weather.h"
 
@@ -35,6 +36,9 @@ static const itype_id fuel_type_none( "null" );
 static const itype_id itype_battery( "battery" );
 static const itype_id itype_seed_buckwheat( "seed_buckwheat" );
 
+static const var_key var_contained_name( "contained_name" );
+static const var_key var_tied_down_furniture( "tied_down_furniture" );
+
 /*-----------------------------------------------------------------------------
  *                              VEHICLE_PART
  *-----------------------------------------------------------------------------*/
@@ -119,12 +123,12 @@ std::string vehicle_part::name( bool with_prefix ) const
     }
     res += info().name();
     // animal carrier
-    if( base.has_var( "contained_name" ) ) {
-        res += string_format( _( " holding %s" ), base.get_var( "contained_name" ) );
+    if( base.has_var( var_contained_name ) ) {
+        res += string_format( _( " holding %s" ), base.get_var( var_contained_name ) );
     }
     // furniture tiedown
-    if( base.has_var( "tied_down_furniture" ) ) {
-        furn_str_id stored_furniture( base.get_var( "tied_down_furniture" ) );
+    if( base.has_var( var_tied_down_furniture ) ) {
+        furn_str_id stored_furniture( base.get_var( var_tied_down_furniture ) );
         if( stored_furniture.is_valid() ) {
             res += string_format( _( " holding %s" ), stored_furniture->name() );
         } else {
@@ -548,7 +552,7 @@ bool vpart_position::can_load_furniture() const
     if( !loader->items().empty() ) {
         return false;
     }
-    if( loader->part().get_base().has_var( "tied_down_furniture" ) ) {
+    if( loader->part().get_base().has_var( var_tied_down_furniture ) ) {
         return false;
     }
     return true;
@@ -560,26 +564,26 @@ bool vpart_position::has_loaded_furniture() const
     if( !loader.has_value() ) {
         return false;
     }
-    return loader->part().get_base().has_var( "tied_down_furniture" );
+    return loader->part().get_base().has_var( var_tied_down_furniture );
 }
 
 void vehicle_part::load_furniture( map &here, const tripoint_bub_ms &from )
 {
-    if( base.has_var( "tied_down_furniture" ) ) {
+    if( base.has_var( var_tied_down_furniture ) ) {
         return;
     }
 
     // The awful hack that makes this all work. We store the furniture's string id directly on the item as an item var.
-    base.set_var( "tied_down_furniture", here.furn( from ).id().str() );
+    base.set_var( var_tied_down_furniture, here.furn( from ).id().str() );
     here.furn_clear( from );
 }
 
 void vehicle_part::unload_furniture( map &here, const tripoint_bub_ms &to )
 {
-    if( !base.has_var( "tied_down_furniture" ) ) {
+    if( !base.has_var( var_tied_down_furniture ) ) {
         return;
     }
-    furn_str_id carried_furn( base.get_var( "tied_down_furniture" ) );
+    furn_str_id carried_furn( base.get_var( var_tied_down_furniture ) );
     if( !carried_furn.is_valid() ) {
         debugmsg( "Invalid carried furniture %s", carried_furn.str() );
         return;
@@ -587,7 +591,7 @@ void vehicle_part::unload_furniture( map &here, const tripoint_bub_ms &to )
     if( here.has_furn( to ) ) {
         return;
     }
-    base.remove_var( "tied_down_furniture" );
+    base.remove_var( var_tied_down_furniture );
     here.furn_set( to, carried_furn );
 }
 
@@ -1224,9 +1224,22 @@ units::temperature weather_manager::get_area_temperature( const tripoint_abs_omt
                get_weather().get_cur_weather_gen().base_temperature ) : temperature;
 }
 
+const weather_sum &weather_manager::get_area_conditions( const time_point &start,
+        const time_point &end, const tripoint_abs_omt &location )
+{
+    const std::tuple<tripoint_abs_omt, time_point, time_point> key( location, start, end );
+    auto it = weather_sum_cache.find( key );
+    if( it == weather_sum_cache.end() ) {
+        const tripoint_abs_ms center = project_to<coords::ms>( location ) + point( SEEX, SEEY );
+        it = weather_sum_cache.emplace( key, sum_conditions( start, end, center ) ).first;
+    }
+    return it->second;
+}
+
 void weather_manager::clear_temp_cache()
 {
     temperature_cache.clear();
+    weather_sum_cache.clear();
 }
 
 const weather_manager &get_weather_const()
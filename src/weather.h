@@ -77,6 +77,8 @@ constexpr float extreme = 906;
 } // namespace irradiance
 
 #include <cstdint>
+#include <map>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -237,6 +239,11 @@ class weather_manager
         time_point nextweather;
         /** temperature cache, cleared every turn, sparse map of map tripoints to temperatures */
         std::unordered_map< tripoint_bub_ms, units::temperature > temperature_cache;
+        /**
+         * Weather summed up by get_area_conditions(), cleared every turn, keyed by overmap
+         * terrain and time interval.
+         */
+        std::map<std::tuple<tripoint_abs_omt, time_point, time_point>, weather_sum> weather_sum_cache;
         // Per-OMT snow depth state, updated incrementally
         std::unordered_map< tripoint_abs_omt, omt_snow_state > snow_depth_map;
         /*
@@ -249,6 +256,13 @@ class weather_manager
         * this is essentially the "natural" temperature.
         */
         units::temperature get_area_temperature( const tripoint_abs_omt &location ) const;
+        /*
+        * Returns sum_conditions() for the center of the given OMT.  The result is
+        * remembered for the rest of the turn, so everything in the same area catching
+        * up over the same interval (e.g. vehicles parked together) shares it.
+        */
+        const weather_sum &get_area_conditions( const time_point &start, const time_point &end,
+                                                const tripoint_abs_omt &location );
         void clear_temp_cache();
         static void serialize_all( JsonOut &json );
         static void unserialize_all( const JsonObject &w );
@@ -73,6 +73,12 @@ TEST_CASE( "localized_compare", "[catacharset][nogame]" )
     CHECK( localized_compare( std::make_tuple( a, c, c ), std::make_tuple( B, a, a ) ) );
     CHECK( localized_compare( std::make_tuple( a, a, c ), std::make_tuple( a, B, a ) ) );
     CHECK( localized_compare( std::make_tuple( a, a, a ), std::make_tuple( a, a, B ) ) );
+    // Collation keys order the same way as the strings they were made from
+    CHECK( !( localized_sort_key( a ) < localized_sort_key( a ) ) );
+    CHECK( localized_sort_key( a ) < localized_sort_key( B ) );
+    CHECK( localized_sort_key( A ) < localized_sort_key( b ) );
+    CHECK( !( localized_sort_key( B ) < localized_sort_key( a ) ) );
+    CHECK( !( localized_sort_key( b ) < localized_sort_key( A ) ) );
     std::locale::global( std::locale::classic() );
 }
 
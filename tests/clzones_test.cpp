@@ -1,4 +1,5 @@
 #include <climits>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <list>
@@ -28,6 +29,7 @@
 #include "map.h"
 #include "map_helpers.h"
 #include "npc.h"
+#include "perf.h"
 #include "player_activity.h"
 #include "player_helpers.h"
 #include "pocket_type.h"
@@ -1510,6 +1512,86 @@ TEST_CASE( "zone_sorting_has_terrain_has_vehicle_helpers",
     CHECK( mgr.has( zone_type_LOOT_FOOD, pos_b ) );
 }
 
+TEST_CASE( "zone_type_for_item_follows_zone_changes", "[zones][items]" )
+{
+    clear_map_without_vision();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.clear();
+
+    const tripoint_abs_ms origin_pos;
+    const item apple( itype_test_apple );
+    const item almond( itype_test_bitter_almond );
+    create_tile_zone( "Food", zone_type_LOOT_FOOD, tripoint_abs_ms::zero + tripoint::east );
+    REQUIRE( zm.get_near_zone_type_for_item( apple, origin_pos ) == zone_type_LOOT_FOOD );
+    REQUIRE( zm.get_near_zone_type_for_item( almond, origin_pos ) == zone_type_LOOT_FOOD );
+
+    create_tile_zone( "PFood", zone_type_LOOT_PFOOD, tripoint_abs_ms::zero + tripoint::west );
+    CHECK( zm.get_near_zone_type_for_item( apple, origin_pos ) == zone_type_LOOT_PFOOD );
+    CHECK( zm.get_near_zone_type_for_item( almond, origin_pos ) == zone_type_LOOT_FOOD );
+    CHECK( zm.get_near_zone_type_for_item( apple, origin_pos + tripoint( 100, 0, 0 ) ) ==
+           zone_type_id::NULL_ID() );
+}
+
+TEST_CASE( "zone_type_for_item_survives_unchanged_vehicle_zones", "[zones][items]" )
+{
+    clear_map_without_vision();
+    zone_manager &zm = zone_manager::get_manager();
+    zm.clear();
+
+    const tripoint_abs_ms origin_pos;
+    const item apple( itype_test_apple );
+    create_tile_zone( "Food", zone_type_LOOT_FOOD, tripoint_abs_ms::zero + tripoint::east );
+    REQUIRE( zm.get_near_zone_type_for_item( apple, origin_pos ) == zone_type_LOOT_FOOD );
+
+    // Vehicles moving re-cache their zones every turn; with no vehicle zones
+    // changing the answers for items must still be served from the cache
+    const cata_cache_stats &stats = cata_cache_stats::get( "zone type cache for items" );
+    const uint64_t hits_before = stats.hits;
+    const uint64_t misses_before = stats.misses;
+    zm.cache_vzones();
+    zm.cache_vzones();
+    CHECK( zm.get_near_zone_type_for_item( apple, origin_pos ) == zone_type_LOOT_FOOD );
+    CHECK( stats.hits == hits_before + 1 );
+    CHECK( stats.misses == misses_before );
+}
+
+TEST_CASE( "zone_range_queries_follow_zone_changes", "[zones]" )
+{
+    map &here = get_map();
+
+    clear_map_without_vision();
+    zone_manager &mgr = zone_manager::get_manager();
+    mgr.clear();
+
+    // Spans the border between two submaps.
+    const tripoint_abs_ms wide_start = here.get_abs( tripoint_bub_ms( 20, 30, 0 ) );
+    const tripoint_abs_ms wide_end = here.get_abs( tripoint_bub_ms( 28, 30, 0 ) );
+    mgr.add( "Wide", zone_type_LOOT_FOOD, faction_your_followers, false, true, wide_start,
+             wide_end );
+    const tripoint_abs_ms tile = here.get_abs( tripoint_bub_ms( 26, 30, 0 ) );
+    create_tile_zone( "Tile", zone_type_LOOT_FOOD, tile );
+    const tripoint_abs_ms distant = here.get_abs( tripoint_bub_ms( 80, 30, 0 ) );
+
+    REQUIRE( mgr.get_zones_at( tile, zone_type_LOOT_FOOD ).size() == 2 );
+    CHECK( mgr.get_zone_at( tile, zone_type_LOOT_FOOD )->get_name() == "Wide" );
+    CHECK( mgr.get_zones_at( wide_end, zone_type_LOOT_FOOD ).size() == 1 );
+    CHECK( mgr.get_zones_at( tile, zone_type_LOOT_DRINK ).empty() );
+
+    CHECK( mgr.has_near( zone_type_LOOT_FOOD, distant, 52 ) );
+    CHECK_FALSE( mgr.has_near( zone_type_LOOT_FOOD, distant, 51 ) );
+    CHECK( mgr.get_nearest( zone_type_LOOT_FOOD, distant, 60 ) == wide_end );
+    CHECK( mgr.get_near( zone_type_LOOT_FOOD, distant, 54 ).size() == 3 );
+
+    std::vector<zone_manager::ref_zone_data> zones = mgr.get_zones();
+    REQUIRE( zones.size() == 2 );
+    mgr.swap( zones[0], zones[1] );
+    CHECK( mgr.get_zone_at( tile, zone_type_LOOT_FOOD )->get_name() == "Tile" );
+
+    mgr.remove( zones[1] );
+    CHECK( mgr.get_zones_at( tile, zone_type_LOOT_FOOD ).size() == 1 );
+    CHECK( mgr.get_zones_at( wide_start, zone_type_LOOT_FOOD ).empty() );
+}
+
 // Batching should consolidate pickups from nearby sources before delivering.
 // Layout: player at S1 (UNSORTED, 10 apples), S2 one tile east (UNSORTED, 10
 // apples), D ten tiles south (LOOT_FOOD). After picking up from S1, the sorter
@@ -1584,6 +1666,113 @@ TEST_CASE( "zone_sorting_batches_nearby_sources",
     CHECK( carried == 20 );
 }
 
+// Batching should look past nearby sources whose items go elsewhere.
+// Layout: player at S1 (UNSORTED, 10 apples), S2 one tile east (UNSORTED, a
+// rod bound for LOOT_DEFAULT), S3 one tile west (UNSORTED, 10 apples), D ten
+// tiles south (LOOT_FOOD). After picking up from S1, the sorter should skip
+// S2 and detour to S3.
+TEST_CASE( "zone_sorting_batches_past_incompatible_sources",
+           "[zones][items][activities][sorting][batching]" )
+{
+    avatar &dummy = get_avatar();
+    map &here = get_map();
+
+    clear_avatar();
+    clear_map_without_vision();
+    zone_manager::get_manager().clear();
+
+    const tripoint_bub_ms s1_pos( 60, 60, 0 );
+    dummy.setpos( here, s1_pos );
+    dummy.clear_destination();
+    dummy.worn.wear_item( dummy, item( itype_backpack ), false, false );
+
+    const tripoint_bub_ms s2_pos = s1_pos + tripoint::east;
+    const tripoint_bub_ms s3_pos = s1_pos + tripoint::west;
+    for( const tripoint_bub_ms &pos : {
+             s1_pos, s2_pos, s3_pos
+         } ) {
+        here.ter_set( pos, ter_t_floor );
+        create_tile_zone( "Unsorted", zone_type_LOOT_UNSORTED, here.get_abs( pos ) );
+    }
+    for( int i = 0; i < 10; i++ ) {
+        here.add_item_or_charges( s1_pos, item( itype_test_apple ) );
+        here.add_item_or_charges( s3_pos, item( itype_test_apple ) );
+    }
+    here.add_item_or_charges( s2_pos, item( itype_test_rod_14cm ) );
+
+    const tripoint_bub_ms dest_pos = s1_pos + tripoint( 0, 10, 0 );
+    for( int y = s1_pos.y() + 1; y <= dest_pos.y(); ++y ) {
+        here.ter_set( tripoint_bub_ms( s1_pos.x(), y, 0 ), ter_t_floor );
+    }
+    create_tile_zone( "Food", zone_type_LOOT_FOOD, here.get_abs( dest_pos ) );
+    const tripoint_bub_ms default_pos = s1_pos + tripoint( 0, -10, 0 );
+    here.ter_set( default_pos, ter_t_floor );
+    create_tile_zone( "Default", zone_type_LOOT_DEFAULT, here.get_abs( default_pos ) );
+
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0, true );
+
+    dummy.assign_activity( zone_sort_activity_actor() );
+    process_activity( dummy );
+
+    CHECK( count_items_or_charges( s1_pos, itype_test_apple, std::nullopt ) == 0 );
+    CHECK( count_items_or_charges( s3_pos, itype_test_apple, std::nullopt ) == 0 );
+    int carried = 0;
+    dummy.visit_items( [&carried]( const item * it, const item * ) {
+        if( it->typeId() == itype_test_apple ) {
+            carried++;
+        }
+        return VisitResponse::NEXT;
+    } );
+    CHECK( carried == 20 );
+}
+
+// The sort plan groups sources by the zone type their items are bound for.
+// Layout: S1 and S3 hold apples (LOOT_FOOD), S2 holds a rod (LOOT_DEFAULT) and
+// S4 is an unsorted tile with nothing on it.
+TEST_CASE( "zone_sorting_plan_groups_sources_by_destination",
+           "[zones][items][activities][sorting][batching]" )
+{
+    avatar &dummy = get_avatar();
+    map &here = get_map();
+
+    clear_avatar();
+    clear_map_without_vision();
+    zone_manager::get_manager().clear();
+
+    const tripoint_bub_ms s1_pos( 60, 60, 0 );
+    dummy.setpos( here, s1_pos );
+
+    const tripoint_bub_ms s2_pos = s1_pos + tripoint::east;
+    const tripoint_bub_ms s3_pos = s1_pos + tripoint::west;
+    const tripoint_bub_ms s4_pos = s1_pos + tripoint::north;
+    std::unordered_set<tripoint_abs_ms> sources;
+    for( const tripoint_bub_ms &pos : {
+             s1_pos, s2_pos, s3_pos, s4_pos
+         } ) {
+        here.ter_set( pos, ter_t_floor );
+        create_tile_zone( "Unsorted", zone_type_LOOT_UNSORTED, here.get_abs( pos ) );
+        sources.insert( here.get_abs( pos ) );
+    }
+    here.add_item_or_charges( s1_pos, item( itype_test_apple ) );
+    here.add_item_or_charges( s3_pos, item( itype_test_apple ) );
+    here.add_item_or_charges( s2_pos, item( itype_test_rod_14cm ) );
+    create_tile_zone( "Food", zone_type_LOOT_FOOD, here.get_abs( s1_pos + tripoint( 0, 10, 0 ) ) );
+    create_tile_zone( "Default", zone_type_LOOT_DEFAULT,
+                      here.get_abs( s1_pos + tripoint( 0, -10, 0 ) ) );
+
+    const zone_sorting::sort_plan plan = zone_sorting::plan_sort_pass( dummy, sources, {} );
+    REQUIRE( plan.count( zone_type_LOOT_FOOD ) == 1 );
+    REQUIRE( plan.count( zone_type_LOOT_DEFAULT ) == 1 );
+    CHECK( plan.size() == 2 );
+    CHECK( plan.at( zone_type_LOOT_FOOD ) == std::unordered_set<tripoint_abs_ms> {
+        here.get_abs( s1_pos ), here.get_abs( s3_pos )
+    } );
+    CHECK( plan.at( zone_type_LOOT_DEFAULT ) == std::unordered_set<tripoint_abs_ms> {
+        here.get_abs( s2_pos )
+    } );
+}
+
 // Batching with a grabbed vehicle: the capacity check should consider the
 // cart's free volume, not just the player's inventory. With 10 apples per
 // source, items overflow into the cart when inventory fills up.
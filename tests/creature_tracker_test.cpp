@@ -0,0 +1,86 @@
+#include <vector>
+
+#include "cata_catch.h"
+#include "coordinates.h"
+#include "creature_tracker.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_helpers_tests.h"
+#include "monster.h"
+#include "point.h"
+#include "type_id.h"
+
+TEST_CASE( "creature_tracker_spatial_queries", "[creature_tracker]" )
+{
+    clear_map();
+    clear_creatures();
+    map &here = get_map();
+    creature_tracker &creatures = get_creature_tracker();
+
+    const tripoint_bub_ms center( 60, 60, 0 );
+    monster &near_mon = spawn_test_monster( "mon_zombie", center + tripoint::east );
+    monster &mid_mon = spawn_test_monster( "mon_zombie", center + tripoint_rel_ms( 10, 0, 0 ) );
+    monster &far_mon = spawn_test_monster( "mon_zombie", center + tripoint_rel_ms( -30, 20, 0 ) );
+    const tripoint_abs_ms center_abs = here.get_abs( center );
+
+    const auto in_radius = [&]( int radius ) {
+        std::vector<monster *> found;
+        creatures.for_each_in_radius( center_abs, radius, [&]( monster & critter ) {
+            found.push_back( &critter );
+        } );
+        return found;
+    };
+    const auto any = []( const monster & ) {
+        return true;
+    };
+
+    CHECK( in_radius( 0 ).empty() );
+    CHECK( in_radius( 1 ) == std::vector<monster *> { &near_mon } );
+    CHECK( in_radius( 10 ).size() == 2 );
+    CHECK( in_radius( 40 ).size() == 3 );
+
+    CHECK( creatures.nearest_matching( center_abs, 40, any ) == &near_mon );
+    CHECK( creatures.nearest_matching( center_abs, 40, [&]( const monster & critter ) {
+        return &critter != &near_mon;
+    } ) == &mid_mon );
+    CHECK( creatures.nearest_matching( center_abs, 5, [&]( const monster & critter ) {
+        return &critter == &far_mon;
+    } ) == nullptr );
+
+    CHECK( creatures.count_in_rect( center_abs, center_abs + tripoint_rel_ms( 10, 0, 0 ), any ) == 2 );
+    CHECK( creatures.count_in_rect( center_abs + tripoint_rel_ms( -40, -40, -1 ),
+                                    center_abs + tripoint_rel_ms( 40, 40, 1 ), any ) == 3 );
+
+    SECTION( "reachable monsters in radius" ) {
+        std::vector<monster *> found;
+        creatures.for_each_reachable_in_radius( near_mon, 9, []( const mfaction_id & ) {
+            return true;
+        }, [&]( monster & critter ) {
+            found.push_back( &critter );
+        } );
+        CHECK( found.size() == 2 );
+
+        // A zone number that matches but wasn't assigned by the current flood fill,
+        // as happens when zone numbers restart after an invalidation
+        monster &stale_mon = spawn_test_monster( "mon_zombie", center + tripoint_rel_ms( 3, 0, 0 ) );
+        stale_mon.set_reachable_zone( near_mon.get_reachable_zone() );
+        found.clear();
+        creatures.for_each_reachable_in_radius( near_mon, 9, []( const mfaction_id & ) {
+            return true;
+        }, [&]( monster & critter ) {
+            found.push_back( &critter );
+        } );
+        CHECK( found.size() == 2 );
+    }
+
+    SECTION( "index follows moving and dying monsters" ) {
+        REQUIRE( near_mon.move_to( center + tripoint_rel_ms( 0, 20, 0 ), true ) );
+        CHECK( creatures.nearest_matching( center_abs, 40, any ) == &mid_mon );
+        CHECK( in_radius( 20 ).size() == 2 );
+
+        mid_mon.die( &here, nullptr );
+        CHECK( in_radius( 20 ) == std::vector<monster *> { &near_mon } );
+        creatures.remove_dead();
+        CHECK( in_radius( 40 ).size() == 2 );
+    }
+}
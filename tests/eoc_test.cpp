@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <functional>
@@ -1580,3 +1581,74 @@ TEST_CASE( "EOC_run_eocs", "[eoc]" )
     CHECK( std::isnan( globvars.get_global_value( "nan_val" ).dbl() ) );
     CHECK( globvars.get_global_value( "copied_val" ) == "BLORG" );
 }
+
+TEST_CASE( "queued_eocs_timing_wheel", "[eoc][nogame]" )
+{
+    const effect_on_condition_id eoc( "queued_eocs_timing_wheel" );
+    const time_point start = calendar::turn_zero + 1_days;
+    // Spread over the current slot, every wheel level and the overflow list
+    const std::vector<time_duration> offsets = {
+        0_turns, 1_turns, 63_turns, 64_turns, 65_turns, 1_hours, 3_days, 1_days,
+        200_days, 5_turns, 5_turns, 2000_days
+    };
+    queued_eocs q;
+    for( const time_duration &offset : offsets ) {
+        q.push( queued_eoc{ eoc, start + offset, {} } );
+    }
+
+    SECTION( "top and pop follow time order" ) {
+        queued_eocs copy( q );
+        std::vector<time_point> popped;
+        while( !copy.empty() ) {
+            popped.push_back( copy.top().time );
+            copy.pop();
+        }
+        CHECK( popped.size() == offsets.size() );
+        CHECK( std::is_sorted( popped.begin(), popped.end() ) );
+        CHECK( copy.list.empty() );
+    }
+
+    SECTION( "take_due returns exactly the entries due" ) {
+        std::vector<queued_eocs::storage_iter> due;
+        q.take_due( start - 1_turns, due );
+        CHECK( due.empty() );
+        // Everything at or before each turn comes out once, however far apart
+        // the calls are
+        size_t taken = 0;
+        for( const time_duration &check : {
+                 0_turns, 5_turns, 64_turns, 2_hours, 3_days, 300_days, 2500_days
+             } ) {
+            due.clear();
+            q.take_due( start + check, due );
+            for( const queued_eocs::storage_iter &it : due ) {
+                CHECK( it->time <= start + check );
+            }
+            taken += due.size();
+            if( !q.empty() ) {
+                CHECK( q.top().time > start + check );
+            }
+        }
+        CHECK( taken == offsets.size() );
+        CHECK( q.empty() );
+        CHECK( q.list.size() == offsets.size() );
+    }
+
+    SECTION( "entries rescheduled into the past are due next" ) {
+        std::vector<queued_eocs::storage_iter> due;
+        q.take_due( start + 1_days, due );
+        REQUIRE( due.size() == 9 );
+        for( queued_eocs::storage_iter &it : due ) {
+            it->time = start;
+            q.schedule( it );
+        }
+        due.clear();
+        q.take_due( start + 1_days, due );
+        CHECK( due.size() == 9 );
+
+        // Going back in time keeps later entries scheduled
+        due.clear();
+        q.take_due( start, due );
+        CHECK( due.empty() );
+        CHECK( q.top().time == start + 3_days );
+    }
+}
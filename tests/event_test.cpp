@@ -26,6 +26,40 @@ TEST_CASE( "construct_event", "[event]" )
     CHECK( e.get<int>( "exp" ) == 100 );
 }
 
+TEST_CASE( "event_payload_matches_data", "[event]" )
+{
+    cata::event e = cata::event::make<event_type::character_kills_monster>(
+                        character_id( 7 ), zombie, 100 );
+    const size_t hash = e.hash();
+    const cata::event::data_type data = e.data();
+    CHECK( data.size() == 3 );
+    CHECK( data.at( "exp" ) == cata_variant( 100 ) );
+    CHECK( cata::event::data_hash( data ) == hash );
+
+    cata::event same = cata::event::make<event_type::character_kills_monster>(
+                           character_id( 7 ), zombie, 100 );
+    cata::event other = cata::event::make<event_type::character_kills_monster>(
+                            character_id( 7 ), zombie, 50 );
+    CHECK( same.hash() == hash );
+    CHECK( same.data_equals( data ) );
+    CHECK_FALSE( other.data_equals( data ) );
+
+    cata::event from_map( event_type::character_kills_monster, calendar::turn,
+                          cata::event::data_type( data ) );
+    CHECK( from_map.hash() == hash );
+    CHECK( from_map.get<int>( "exp" ) == 100 );
+
+    // Strings and ids must hash and compare the same way as the variants they become.
+    cata::event named = cata::event::make<event_type::character_kills_character>(
+                            character_id( 1 ), character_id( 2 ), "a victim with a long name", "survivor" );
+    CHECK( named.get<std::string>( "victim_name" ) == "a victim with a long name" );
+    CHECK( named.get_variant( "victim" ) == cata_variant( character_id( 2 ) ) );
+    const cata::event::data_type named_data = named.data();
+    CHECK( cata::event::data_hash( named_data ) == named.hash() );
+    CHECK( named.data_equals( named_data ) );
+    CHECK_FALSE( named.data_equals( data ) );
+}
+
 namespace
 {
 
@@ -147,6 +147,17 @@ bool map_meddler::has_altered_submaps( map &m )
     return false;
 }
 
+int map_meddler::count_nonuniform_submaps( const map &m )
+{
+    int count = 0;
+    for( const submap *sm : m.grid ) {
+        if( sm != nullptr && !sm->is_uniform() ) {
+            count++;
+        }
+    }
+    return count;
+}
+
 submap *map_meddler::unsafe_get_submap_at( tripoint_bub_ms &p, point_sm_ms &l )
 {
     return get_map().unsafe_get_submap_at( p, l );
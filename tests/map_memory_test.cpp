@@ -4,7 +4,11 @@
 #include <string>
 
 #include "cata_catch.h"
+#include "cata_utility.h"
 #include "coordinates.h"
+#include "flexbuffer_json.h"
+#include "json.h"
+#include "json_loader.h"
 #include "lru_cache.h"
 #include "map.h"
 #include "map_memory.h"
@@ -122,6 +126,51 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     CHECK( mt.get_dec_rotation() == 0 );
 }
 
+TEST_CASE( "map_memory_submap_palette_round_trip", "[map_memory]" )
+{
+    mm_submap sm;
+    CHECK( sm.is_empty() );
+    sm.set_tile( point_sm_ms::zero, mm_submap::default_tile );
+    CHECK( sm.is_empty() );
+
+    memorized_tile wall;
+    wall.set_ter_id( "t_foo" );
+    wall.symbol = '#';
+    memorized_tile chair = wall;
+    chair.set_dec_id( "f_foo" );
+    chair.set_dec_rotation( 2 );
+    // Every tile distinct, so the palette is as large as it can get.
+    for( int y = 0; y < SEEY; y++ ) {
+        for( int x = 0; x < SEEX; x++ ) {
+            memorized_tile mt = wall;
+            mt.symbol = y * SEEX + x;
+            sm.set_tile( point_sm_ms( x, y ), mt );
+        }
+    }
+    // Then overwrite most of them, recycling the palette entries.
+    for( int y = 0; y < SEEY; y++ ) {
+        for( int x = 0; x < SEEX - 1; x++ ) {
+            sm.set_tile( point_sm_ms( x, y ), y % 2 ? wall : chair );
+        }
+    }
+
+    const std::string saved = serialize_wrapper( [&]( JsonOut & jsout ) {
+        sm.serialize( jsout );
+    } );
+    mm_submap loaded;
+    loaded.deserialize( 2, json_loader::from_string( saved ) );
+    for( int y = 0; y < SEEY; y++ ) {
+        for( int x = 0; x < SEEX; x++ ) {
+            const point_sm_ms p( x, y );
+            CAPTURE( p );
+            CHECK( loaded.get_tile( p ) == sm.get_tile( p ) );
+        }
+    }
+    CHECK( loaded.get_tile( point_sm_ms( 0, 0 ) ).get_dec_id() == "f_foo" );
+    CHECK( loaded.get_tile( point_sm_ms( 0, 1 ) ).get_dec_id().empty() );
+    CHECK( loaded.get_tile( point_sm_ms( SEEX - 1, 1 ) ).symbol == 2 * SEEX - 1 );
+}
+
 // TODO: map memory save / load
 
 #include <chrono>
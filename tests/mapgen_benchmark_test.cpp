@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "calendar.h"
+#include "cata_catch.h"
+#include "cata_utility.h"
+#include "coordinates.h"
+#include "debug.h"
+#include "json.h"
+#include "map.h"
+#include "map_helpers_tests.h"
+#include "mapbuffer.h"
+#include "mapgen.h"
+#include "mapgen_functions.h"
+#include "mapgendata.h"
+#include "omdata.h"
+#include "overmapbuffer.h"
+#include "rng.h"
+#include "string_formatter.h"
+#include "type_id.h"
+#include "weighted_list.h"
+
+// Timings of one mapgen id, collected by the mapgen benchmark below.
+struct mapgen_timings {
+    std::string kind;
+    std::string id;
+    std::vector<double> micros;
+    // Submaps that ended up non-uniform, summed over all samples, or -1 if not measured.
+    int nonuniform_submaps = -1;
+
+    double mean() const {
+        return std::accumulate( micros.begin(), micros.end(), 0.0 ) / micros.size();
+    }
+    // Nearest-rank percentile.
+    double percentile( double pct ) const {
+        std::vector<double> sorted = micros;
+        std::sort( sorted.begin(), sorted.end() );
+        const size_t rank = static_cast<size_t>( std::ceil( pct / 100.0 * sorted.size() ) );
+        return sorted[std::max<size_t>( rank, 1 ) - 1];
+    }
+};
+
+static int env_int( const char *name, int fallback )
+{
+    const char *value = std::getenv( name );
+    return value == nullptr ? fallback : std::max( 1, std::atoi( value ) );
+}
+
+static std::string env_string( const char *name )
+{
+    const char *value = std::getenv( name );
+    return value == nullptr ? std::string() : std::string( value );
+}
+
+template<typename F>
+static double time_micros( const F &f )
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>( end - start ).count();
+}
+
+static void write_mapgen_timings( std::ostream &os, const std::vector<mapgen_timings> &results )
+{
+    JsonOut jsout( os, true );
+    jsout.start_array();
+    for( const mapgen_timings &r : results ) {
+        jsout.start_object();
+        jsout.member( "kind", r.kind );
+        jsout.member( "id", r.id );
+        jsout.member( "samples", r.micros.size() );
+        jsout.member( "mean_us", r.mean() );
+        jsout.member( "p99_us", r.percentile( 99 ) );
+        if( r.nonuniform_submaps >= 0 ) {
+            jsout.member( "nonuniform_submaps", r.nonuniform_submaps );
+        }
+        jsout.end_object();
+    }
+    jsout.end_array();
+}
+
+// Benchmarks are skipped by default by using [.] tag.
+// Runs every registered overmap terrain, nested and update mapgen into throwaway
+// maps and reports the mean and 99th percentile time of each id.  Configured
+// through the environment:
+// CATA_MAPGEN_BENCHMARK_SAMPLES - how often each id is run, 3 by default.
+// CATA_MAPGEN_BENCHMARK_FILTER - only run ids containing this string.
+// CATA_MAPGEN_BENCHMARK_OUTPUT - write the results to this file as JSON.
+TEST_CASE( "mapgen_benchmark", "[.][mapgen][benchmark]" )
+{
+    const int samples = env_int( "CATA_MAPGEN_BENCHMARK_SAMPLES", 3 );
+    const std::string filter = env_string( "CATA_MAPGEN_BENCHMARK_FILTER" );
+    const std::string output = env_string( "CATA_MAPGEN_BENCHMARK_OUTPUT" );
+    const auto wanted = [&filter]( const std::string & id ) {
+        return filter.empty() || id.find( filter ) != std::string::npos;
+    };
+
+    const tripoint_abs_omt pos( 50, 50, 0 );
+    rng_set_engine_seed( 4242 );
+    std::vector<mapgen_timings> results;
+
+    const oter_id previous_oter = overmap_buffer.ter( pos );
+    // Many overmap terrains share a mapgen id, e.g. rotations; run each id once.
+    std::map<std::string, oter_id> oter_mapgens;
+    for( const oter_t &oter : overmap_terrains::get_all() ) {
+        const std::string mapgen_id = oter.get_mapgen_id();
+        if( wanted( mapgen_id ) && has_mapgen_for( mapgen_id ) ) {
+            oter_mapgens.emplace( mapgen_id, oter.id.id() );
+        }
+    }
+    for( const std::pair<const std::string, oter_id> &mapgen : oter_mapgens ) {
+        mapgen_timings &r = results.emplace_back();
+        r.kind = "overmap_terrain";
+        r.id = mapgen.first;
+        r.nonuniform_submaps = 0;
+        overmap_buffer.ter_set( pos, mapgen.second );
+        for( int i = 0; i < samples; i++ ) {
+            MAPBUFFER.clear_outside_reality_bubble();
+            smallmap tm;
+            capture_debugmsg_during( [&]() {
+                r.micros.push_back( time_micros( [&]() {
+                    tm.generate( pos, calendar::turn, false );
+                } ) );
+            } );
+            r.nonuniform_submaps += map_meddler::count_nonuniform_submaps( *tm.cast_to_map() );
+            tm.delete_unmerged_submaps();
+        }
+    }
+    overmap_buffer.ter_set( pos, previous_oter );
+
+    for( const std::pair<const nested_mapgen_id, nested_mapgen> &nested : nested_mapgens ) {
+        if( !wanted( nested.first.str() ) || nested.second.funcs().empty() ) {
+            continue;
+        }
+        mapgen_timings &r = results.emplace_back();
+        r.kind = "nested";
+        r.id = nested.first.str();
+        MAPBUFFER.clear_outside_reality_bubble();
+        tinymap tm;
+        tm.load( pos, true );
+        mapgendata md( pos, *tm.cast_to_map(), 0.0f, calendar::turn, nullptr );
+        for( int i = 0; i < samples; i++ ) {
+            const std::shared_ptr<mapgen_function_json_nested> &func = *nested.second.funcs().pick();
+            capture_debugmsg_during( [&]() {
+                r.micros.push_back( time_micros( [&]() {
+                    func->nest( md, tripoint_rel_ms::zero, "benchmark" );
+                } ) );
+            } );
+        }
+        r.nonuniform_submaps = map_meddler::count_nonuniform_submaps( *tm.cast_to_map() );
+    }
+
+    for( const std::pair<const update_mapgen_id, update_mapgen> &update : update_mapgens ) {
+        if( !wanted( update.first.str() ) ) {
+            continue;
+        }
+        mapgen_timings &r = results.emplace_back();
+        r.kind = "update";
+        r.id = update.first.str();
+        for( int i = 0; i < samples; i++ ) {
+            // Generate the map being updated up front so only the update itself is timed.
+            MAPBUFFER.clear_outside_reality_bubble();
+            smallmap tm;
+            tm.load( pos, true );
+            mapgendata md( pos, *tm.cast_to_map(), 0.0f, calendar::turn, nullptr );
+            capture_debugmsg_during( [&]() {
+                r.micros.push_back( time_micros( [&]() {
+                    run_mapgen_update_func( update.first, md, false );
+                } ) );
+            } );
+            tm.delete_unmerged_submaps();
+        }
+    }
+    MAPBUFFER.clear_outside_reality_bubble();
+
+    std::sort( results.begin(), results.end(),
+    []( const mapgen_timings & l, const mapgen_timings & r ) {
+        return l.mean() > r.mean();
+    } );
+    std::cout << string_format( "%-16s %-48s %12s %12s %10s\n", "kind", "id", "mean (us)",
+                                "p99 (us)", "submaps" );
+    for( const mapgen_timings &r : results ) {
+        std::cout << string_format( "%-16s %-48s %12.1f %12.1f %10d\n", r.kind, r.id, r.mean(),
+                                    r.percentile( 99 ), r.nonuniform_submaps );
+    }
+    if( !output.empty() ) {
+        write_to_file( output, [&results]( std::ostream & os ) {
+            write_mapgen_timings( os, results );
+        } );
+    }
+    CHECK_FALSE( results.empty() );
+}
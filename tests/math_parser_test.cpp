@@ -4,24 +4,32 @@
 #include <functional>
 #include <locale>
 #include <memory>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "avatar.h"
 #include "cata_catch.h"
+#include "cata_path.h"
 #include "cata_scope_helpers.h"
+#include "cata_utility.h"
 #include "coordinates.h"
 #include "debug.h"
 #include "dialogue.h"
+#include "filesystem.h"
+#include "flexbuffer_json.h"
 #include "global_vars.h"
 #include "math_parser.h"
 #include "math_parser_diag_value.h"
 #include "math_parser_func.h"
 #include "math_parser_type.h"
 #include "npc.h"
+#include "path_info.h"
 #include "point.h"
+#include "rng.h"
 #include "talker.h"
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity): false positive
@@ -443,3 +451,191 @@ TEST_CASE( "math_parser_dialogue_integration", "[math_parser]" )
     CHECK_THROWS_AS( testexp.eval( d ), math::exception );
 
 }
+
+static void collect_math_expressions( JsonValue const &jv, std::vector<std::string> &out )
+{
+    if( jv.test_array() ) {
+        for( JsonValue const entry : jv.get_array() ) {
+            collect_math_expressions( entry, out );
+        }
+        return;
+    }
+    if( !jv.test_object() ) {
+        return;
+    }
+    JsonObject const jo = jv.get_object();
+    jo.allow_omitted_members();
+    for( JsonMember const member : jo ) {
+        if( member.name() != "math" || !member.test_array() ) {
+            collect_math_expressions( member, out );
+            continue;
+        }
+        // combined the same way as eoc_math::from_json
+        std::string combined;
+        bool all_strings = true;
+        for( JsonValue const part : member.get_array() ) {
+            if( part.test_string() ) {
+                combined.append( part.get_string() );
+            } else {
+                all_strings = false;
+            }
+        }
+        if( all_strings && !combined.empty() ) {
+            out.emplace_back( std::move( combined ) );
+        }
+    }
+}
+
+// Every math expression in data/json
+static const std::vector<std::string> &data_math_expressions()
+{
+    static const std::vector<std::string> expressions = []() {
+        std::vector<std::string> ret;
+        for( cata_path const &file : get_files_from_path( ".json", PATH_INFO::jsondir(), true, true ) ) {
+            read_from_file_json( file, [&ret]( JsonValue const & jv ) {
+                collect_math_expressions( jv, ret );
+            } );
+        }
+        return ret;
+    }();
+    return expressions;
+}
+
+namespace
+{
+struct eval_result {
+    double value = 0;
+    bool threw = false;
+};
+} // namespace
+
+template<typename F>
+static eval_result eval_quietly( F const &f )
+{
+    eval_result ret;
+    capture_debugmsg_during( [&ret, &f]() {
+        try {
+            ret.value = f();
+        } catch( math::exception const & ) {
+            ret.threw = true;
+        }
+    } );
+    return ret;
+}
+
+static bool parse_quietly( math_exp &exp, std::string const &expression )
+{
+    bool parsed = false;
+    capture_debugmsg_during( [&]() {
+        try {
+            parsed = exp.parse( expression, false );
+        } catch( math::exception const & ) {
+            parsed = false;
+        }
+    } );
+    return parsed;
+}
+
+TEST_CASE( "math_parser_compiled_matches_tree", "[math_parser]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    const_dialogue const &cd = d;
+    get_globals().set_global_value( "x", 100 );
+    get_avatar().set_value( "x", 92 );
+    dude.set_value( "x", 21 );
+
+    std::vector<std::string> const &expressions = data_math_expressions();
+    REQUIRE( !expressions.empty() );
+    math_exp testexp;
+    int compared = 0;
+    for( std::string const &expression : expressions ) {
+        // the two paths may roll in a different order
+        if( expression.find( "rand(" ) != std::string::npos ||
+            expression.find( "rng(" ) != std::string::npos ) {
+            continue;
+        }
+        if( !parse_quietly( testexp, expression ) ) {
+            continue;
+        }
+        CAPTURE( expression );
+        rng_set_engine_seed( 1234 );
+        eval_result const compiled = eval_quietly( [&]() {
+            return testexp.eval( cd );
+        } );
+        rng_set_engine_seed( 1234 );
+        eval_result const tree = eval_quietly( [&]() {
+            return testexp.eval_tree( cd );
+        } );
+        CHECK( compiled.threw == tree.threw );
+        if( !compiled.threw && !tree.threw && !( std::isnan( compiled.value ) &&
+                std::isnan( tree.value ) ) ) {
+            CHECK( compiled.value == Approx( tree.value ) );
+        }
+        compared++;
+    }
+    CHECK( compared > 1000 );
+
+    // constant subexpressions are folded, but chance still applies every time
+    CHECK( testexp.parse( "rand( 1 ) + rand( 1 ) + rand( 1 ) + rand( 1 ) + rand( 1 )" ) );
+    std::set<double> seen;
+    for( int i = 0; i < 50; i++ ) {
+        seen.insert( testexp.eval( d ) );
+    }
+    CHECK( seen.size() > 1 );
+
+    // assignments are still refused outside an assignment context
+    CHECK( testexp.parse( "_testvar = 3" ) );
+    CHECK_THROWS_AS( testexp.eval( cd ), math::exception );
+
+    // and write straight to their slots inside one
+    CHECK( testexp.parse( "_testvar = x + u_x * 2" ) );
+    testexp.eval( d );
+    CHECK( d.get_value( "testvar" ) == 284 );
+}
+
+TEST_CASE( "math_parser_compiled_benchmark", "[.][math_parser][benchmark]" )
+{
+    standard_npc dude;
+    dialogue d( get_talker_for( get_avatar() ), get_talker_for( &dude ) );
+    const_dialogue const &cd = d;
+
+    // only the expressions that evaluate cleanly here, so that the timings
+    // are not dominated by exceptions and error reporting
+    std::vector<math_exp> exps;
+    for( std::string const &expression : data_math_expressions() ) {
+        math_exp exp;
+        if( !parse_quietly( exp, expression ) ) {
+            continue;
+        }
+        bool clean = true;
+        std::string const errors = capture_debugmsg_during( [&]() {
+            try {
+                exp.eval_tree( cd );
+            } catch( math::exception const & ) {
+                clean = false;
+            }
+        } );
+        if( clean && errors.empty() ) {
+            exps.emplace_back( std::move( exp ) );
+        }
+    }
+    REQUIRE( !exps.empty() );
+    WARN( exps.size() << " of " << data_math_expressions().size() <<
+          " expressions from data/json" );
+
+    BENCHMARK( "tree" ) {
+        double total = 0;
+        for( const math_exp &exp : exps ) {
+            total += exp.eval_tree( cd );
+        }
+        return total;
+    };
+    BENCHMARK( "compiled" ) {
+        double total = 0;
+        for( const math_exp &exp : exps ) {
+            total += exp.eval( cd );
+        }
+        return total;
+    };
+}
@@ -4214,6 +4214,45 @@ TEST_CASE( "fleeing_follower_not_forced_to_attack", "[npc][behavior][combat]" )
     CHECK( dist_after >= dist_before );
 }
 
+// Every NPC assessing danger in a turn shares one npc_threat_snapshot.  It
+// must still pick up monsters that appear after it was taken.
+TEST_CASE( "npc_threat_snapshot_follows_monster_list", "[npc][npc_ai]" )
+{
+    clear_map_without_vision();
+    clear_avatar();
+    map &here = get_map();
+    Character &pc = get_player_character();
+    pc.setpos( here, tripoint_bub_ms( 50, 50, 0 ) );
+    REQUIRE( npc_threat_snapshot::get().monsters.empty() );
+
+    npc &guy = spawn_npc( { 49, 50 }, "test_talker" );
+    clear_character( guy, true );
+    guy.setpos( here, tripoint_bub_ms( 49, 50, 0 ) );
+    guy.set_fac( faction_your_followers );
+    guy.set_attitude( NPCATT_FOLLOW );
+    guy.rules.set_flag( ally_rule::follow_close );
+    guy.set_mission( NPC_MISSION_NULL );
+    guy.guard_pos = std::nullopt;
+    guy.clear_ai_guard_pos();
+    guy.set_wielded_item( item( itype_bat ) );
+
+    const monster &zomb = spawn_test_monster( "mon_zombie_brute_shocker",
+                          pc.pos_bub() + point::east );
+    here.build_map_cache( 0 );
+    {
+        const npc_threat_snapshot &snapshot = npc_threat_snapshot::get();
+        REQUIRE( snapshot.monsters.size() == 1 );
+        CHECK( snapshot.monsters.front().critter.lock().get() == &zomb );
+        CHECK( snapshot.monsters.front().speed_rating == zomb.speed_rating() );
+    }
+    guy.regen_ai_cache();
+    CHECK( guy.get_ai_danger() > NPC_DANGER_VERY_LOW );
+
+    // Same turn, so only the change to the monster list retakes the snapshot
+    spawn_test_monster( "mon_zombie", pc.pos_bub() + point::south );
+    CHECK( npc_threat_snapshot::get().monsters.size() == 2 );
+}
+
 TEST_CASE( "goto_order_beats_generic_follow", "[npc][behavior]" )
 {
     clear_map_without_vision();
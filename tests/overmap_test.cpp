@@ -55,6 +55,8 @@ static const oter_str_id oter_cabin_east( "cabin_east" );
 static const oter_str_id oter_cabin_north( "cabin_north" );
 static const oter_str_id oter_cabin_south( "cabin_south" );
 static const oter_str_id oter_cabin_west( "cabin_west" );
+static const oter_str_id oter_field( "field" );
+static const oter_str_id oter_lake_surface( "lake_surface" );
 
 static const overmap_special_id overmap_special_Cabin( "Cabin" );
 static const overmap_special_id overmap_special_Lab( "Lab" );
@@ -330,6 +332,27 @@ TEST_CASE( "is_ot_match", "[overmap][terrain]" )
         CHECK_FALSE( is_ot_match( "forest", oter_id( "sewer_sub_station" ), ot_match_type::contains ) );
         CHECK_FALSE( is_ot_match( "forestry", oter_id( "forest" ), ot_match_type::contains ) );
     }
+
+    SECTION( "compiled matchers agree with is_ot_match" ) {
+        const std::pair<std::string, ot_match_type> patterns[] = {
+            { "forest", ot_match_type::exact },
+            { "sub_station", ot_match_type::type },
+            { "forest", ot_match_type::prefix },
+            { "sub", ot_match_type::contains },
+        };
+        for( const auto &[name, match_type] : patterns ) {
+            CAPTURE( name, match_type );
+            const oter_matcher matcher( name, match_type );
+            CHECK( &oter_matcher::get( name, match_type ) == &oter_matcher::get( name, match_type ) );
+            for( const oter_t &ter : overmap_terrains::get_all() ) {
+                const oter_id id = ter.id.id();
+                CAPTURE( id.id().str() );
+                CHECK( matcher.matches( id ) == is_ot_match( name, id, match_type ) );
+                CHECK( oter_matcher::get( name, match_type ).matches( id ) ==
+                       is_ot_match( name, id, match_type ) );
+            }
+        }
+    }
 }
 
 TEST_CASE( "mutable_overmap_placement", "[overmap][slow]" )
@@ -963,6 +986,137 @@ TEST_CASE( "highway_connections_default_to_invalid", "[overmap][highway]" )
     }
 }
 
+TEST_CASE( "overmap_terrain_index_follows_ter_set", "[overmap][terrain]" )
+{
+    overmap_buffer.clear();
+
+    // Heap-allocated because overmap's map_layer arrays overflow the stack.
+    auto om = std::make_unique<overmap>( point_abs_om( 0, 0 ) );
+    const std::vector<std::pair<std::string, ot_match_type>> cabins = {
+        { "cabin", ot_match_type::type }
+    };
+    CHECK( om->find_terrain_matches( cabins ).empty() );
+
+    const tripoint_om_omt first( 10, 20, 0 );
+    const tripoint_om_omt second( 5, 30, 0 );
+    const oter_id default_ter = om->ter( first );
+    om->ter_set( first, oter_cabin_north.id() );
+    CHECK( om->find_terrain_matches( cabins ) == std::vector<tripoint_om_omt> { first } );
+
+    // Changes after the index was built update it in place, results stay sorted
+    om->ter_set( second, oter_cabin_east.id() );
+    CHECK( om->find_terrain_matches( cabins ) == std::vector<tripoint_om_omt> { second, first } );
+    CHECK( om->find_terrain_matches( { { "cabin_east", ot_match_type::exact } } ) ==
+           std::vector<tripoint_om_omt> { second } );
+    CHECK( om->find_terrain_matches( cabins, 1, OVERMAP_HEIGHT ).empty() );
+
+    // Default terrain isn't indexed but is still found
+    const std::vector<std::pair<std::string, ot_match_type>> defaults = {
+        { default_ter.id().str(), ot_match_type::exact }
+    };
+    CHECK( om->find_terrain_matches( defaults, 0, 0 ).size() ==
+           static_cast<size_t>( OMAPX * OMAPY - 2 ) );
+    om->ter_set( first, default_ter );
+    CHECK( om->find_terrain_matches( cabins ) == std::vector<tripoint_om_omt> { second } );
+    CHECK( om->find_terrain_matches( defaults, 0, 0 ).size() ==
+           static_cast<size_t>( OMAPX * OMAPY - 1 ) );
+}
+
+TEST_CASE( "overmap_mondensity_sum_follows_ter_set", "[overmap][terrain]" )
+{
+    overmap_buffer.clear();
+
+    auto om = std::make_unique<overmap>( point_abs_om( 0, 0 ) );
+    const auto brute_force_sum = [&om]( const point_om_omt & min, const point_om_omt & max, int z ) {
+        int sum = 0;
+        for( int x = min.x(); x <= max.x(); x++ ) {
+            for( int y = min.y(); y <= max.y(); y++ ) {
+                sum += om->ter( tripoint_om_omt( x, y, z ) )->get_mondensity();
+            }
+        }
+        return sum;
+    };
+    const point_om_omt min( 8, 18 );
+    const point_om_omt max( 14, 24 );
+    const int base_sum = brute_force_sum( min, max, 0 );
+    CHECK( om->mondensity_sum( min, max, 0 ) == base_sum );
+
+    // Changes after the table was built are picked up
+    const int cabin_density = oter_cabin_north->get_mondensity();
+    REQUIRE( cabin_density != om->ter( tripoint_om_omt( 10, 20, 0 ) )->get_mondensity() );
+    om->ter_set( tripoint_om_omt( 10, 20, 0 ), oter_cabin_north.id() );
+    om->ter_set( tripoint_om_omt( 14, 24, 0 ), oter_cabin_east.id() );
+    om->ter_set( tripoint_om_omt( 15, 24, 0 ), oter_cabin_east.id() );
+    CHECK( om->mondensity_sum( min, max, 0 ) == brute_force_sum( min, max, 0 ) );
+    CHECK( om->mondensity_sum( point_om_omt( 10, 20 ), point_om_omt( 10, 20 ), 0 ) == cabin_density );
+    CHECK( om->mondensity_sum( min, max, 1 ) == brute_force_sum( min, max, 1 ) );
+
+    // Rectangles reaching past the edge of the overmap are clipped
+    CHECK( om->mondensity_sum( point_om_omt( -3, -3 ), point_om_omt( 3, 3 ), 0 ) ==
+           brute_force_sum( point_om_omt( 0, 0 ), point_om_omt( 3, 3 ), 0 ) );
+    CHECK( om->mondensity_sum( point_om_omt( OMAPX, 0 ), point_om_omt( OMAPX + 3, 3 ), 0 ) == 0 );
+}
+
+TEST_CASE( "overmap_travel_path_follows_ter_set", "[overmap][pathfinding]" )
+{
+    overmap_buffer.clear();
+
+    // A strip of fields surrounded by lake, so the route can't leave it
+    const tripoint_abs_omt base = project_to<coords::omt>( tripoint_abs_om( 0, 0, 0 ) );
+    for( int x = 8; x <= 22; x++ ) {
+        for( int y = 8; y <= 14; y++ ) {
+            const bool strip = x >= 10 && x <= 20 && y >= 10 && y <= 12;
+            overmap_buffer.ter_set( base + tripoint( x, y, 0 ),
+                                    strip ? oter_field.id() : oter_lake_surface.id() );
+        }
+    }
+    const tripoint_abs_omt src = base + tripoint( 10, 11, 0 );
+    const tripoint_abs_omt dest = base + tripoint( 20, 11, 0 );
+    const tripoint_abs_omt middle = base + tripoint( 15, 11, 0 );
+    const overmap_path_params params = overmap_path_params::for_npc();
+
+    const std::vector<tripoint_abs_omt> straight = overmap_buffer.get_travel_path( src, dest,
+            params ).points;
+    REQUIRE_FALSE( straight.empty() );
+    CHECK( std::find( straight.begin(), straight.end(), middle ) != straight.end() );
+    CHECK( overmap_buffer.get_travel_path( src, dest, params ).points == straight );
+
+    // Blocking the way must not return the cached route
+    overmap_buffer.ter_set( middle, oter_lake_surface.id() );
+    const std::vector<tripoint_abs_omt> detour = overmap_buffer.get_travel_path( src, dest,
+            params ).points;
+    REQUIRE_FALSE( detour.empty() );
+    CHECK( std::find( detour.begin(), detour.end(), middle ) == detour.end() );
+
+    // Closing the strip off leaves no route
+    for( int y = 10; y <= 12; y++ ) {
+        overmap_buffer.ter_set( base + tripoint( 15, y, 0 ), oter_lake_surface.id() );
+    }
+    CHECK( overmap_buffer.get_travel_path( src, dest, params ).points.empty() );
+}
+
+TEST_CASE( "prepare_overmap_near_generates_one_overmap_at_a_time", "[overmap]" )
+{
+    overmap_buffer.clear();
+
+    const point_abs_om origin_om( 0, 0 );
+    const point_abs_om east_om = origin_om + point::east;
+    overmap_buffer.get( origin_om );
+    REQUIRE_FALSE( overmap_buffer.has( east_om ) );
+
+    // Well inside the overmap, nothing else is close enough
+    const tripoint_abs_omt middle( project_to<coords::omt>( origin_om ) + point( OMAPX / 2, OMAPY / 2 ),
+                                   0 );
+    CHECK_FALSE( overmap_buffer.prepare_overmap_near( middle, 10 ) );
+    CHECK_FALSE( overmap_buffer.has( east_om ) );
+
+    // Close to the eastern edge only the eastern neighbour gets generated
+    const tripoint_abs_omt east_edge = middle + tripoint( OMAPX / 2 - 5, 0, 0 );
+    CHECK( overmap_buffer.prepare_overmap_near( east_edge, 10 ) );
+    CHECK( overmap_buffer.has( east_om ) );
+    CHECK_FALSE( overmap_buffer.prepare_overmap_near( east_edge, 10 ) );
+}
+
 TEST_CASE( "highway_neighbor_missing_connections_no_crash", "[overmap][highway]" )
 {
     overmap_buffer.clear();
@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -19,6 +20,7 @@
 #include "event_subscriber.h"
 #include "flexbuffer_json.h"
 #include "game.h"
+#include "json.h"
 #include "json_loader.h"
 #include "map_scale_constants.h"
 #include "options_helpers.h"
@@ -404,6 +406,45 @@ TEST_CASE( "stats_tracker_with_event_statistics", "[stats]" )
     }
 }
 
+TEST_CASE( "stats_tracker_value_of_follows_events", "[stats]" )
+{
+    stats_tracker s;
+    event_bus b;
+    b.subscribe( &s );
+
+    const character_id u_id = get_player_character().getID();
+    const cata::event avatar_zombie_kill =
+        cata::event::make<event_type::character_kills_monster>( u_id, mon_zombie, 0 );
+    const cata::event avatar_dog_kill =
+        cata::event::make<event_type::character_kills_monster>( u_id, mon_dog, 0 );
+
+    send_game_start( b, u_id );
+    CHECK( s.value_of( event_statistic_num_avatar_zombie_kills ).get<int>() == 0 );
+    b.send( avatar_zombie_kill );
+    b.send( avatar_dog_kill );
+    b.send( avatar_zombie_kill );
+    CHECK( s.value_of( event_statistic_num_avatar_zombie_kills ).get<int>() == 2 );
+    CHECK( s.value_of( event_statistic_num_avatar_monster_kills ).get<int>() == 3 );
+    CHECK( s.value_of( event_statistic_num_avatar_zombie_kills ) ==
+           event_statistic_num_avatar_zombie_kills->value( s ) );
+
+    // Loading over a tracker that has already answered queries must not leave
+    // those answers stale
+    std::ostringstream os;
+    JsonOut jsout( os );
+    s.serialize( jsout );
+
+    stats_tracker loaded;
+    event_bus loaded_bus;
+    loaded_bus.subscribe( &loaded );
+    send_game_start( loaded_bus, u_id );
+    CHECK( loaded.value_of( event_statistic_num_avatar_zombie_kills ).get<int>() == 0 );
+    JsonValue jsin = json_loader::from_string( os.str() );
+    loaded.deserialize( jsin.get_object() );
+    CHECK( loaded.value_of( event_statistic_num_avatar_zombie_kills ).get<int>() == 2 );
+    CHECK( loaded.value_of( event_statistic_num_avatar_monster_kills ).get<int>() == 3 );
+}
+
 namespace
 {
 
@@ -0,0 +1,64 @@
+#include <sstream>
+#include <string>
+
+#include "cata_catch.h"
+#include "flexbuffer_json.h"
+#include "global_vars.h"
+#include "json.h"
+#include "json_loader.h"
+#include "math_parser_diag_value.h"
+#include "var_key.h"
+
+TEST_CASE( "var_key_interns_names", "[var][nogame]" )
+{
+    const var_key a( "var_key_test_a" );
+    const var_key b( std::string( "var_key_test_b" ) );
+    const var_key a_again( std::string_view( "var_key_test_a" ) );
+
+    CHECK( a == a_again );
+    CHECK( a.id() == a_again.id() );
+    CHECK( a != b );
+    CHECK( a.str() == "var_key_test_a" );
+    CHECK( b.str() == "var_key_test_b" );
+    CHECK( a < b );
+    CHECK_FALSE( b < a );
+    CHECK_FALSE( a < a_again );
+
+    CHECK( var_key().empty() );
+    CHECK( var_key( "" ) == var_key() );
+    CHECK_FALSE( a.empty() );
+}
+
+TEST_CASE( "var_key_stores_round_trip_as_names", "[var][nogame]" )
+{
+    global_variables::impl_t vars;
+    vars[ "var_key_test_first" ] = diag_value( 3.0 );
+    vars[ "var_key_test_second" ] = diag_value( std::string( "text" ) );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.write( vars );
+    const std::string written = os.str();
+    CHECK( written.find( "\"var_key_test_first\"" ) != std::string::npos );
+    CHECK( written.find( "\"var_key_test_second\"" ) != std::string::npos );
+
+    global_variables::impl_t read_back;
+    JsonValue jsin = json_loader::from_string( written );
+    jsin.read( read_back );
+    REQUIRE( read_back.size() == 2 );
+    CHECK( read_back.at( "var_key_test_first" ).dbl() == 3.0 );
+    CHECK( read_back.at( "var_key_test_second" ).str() == "text" );
+}
+
+TEST_CASE( "var_key_lookups_do_not_intern_names", "[var][nogame]" )
+{
+    global_variables globals;
+    globals.set_global_value( "var_key_test_set", 1.0 );
+    CHECK( var_key::find( "var_key_test_set" ) == var_key( "var_key_test_set" ) );
+    CHECK( globals.maybe_get_global_value( "var_key_test_set" ) != nullptr );
+
+    CHECK( globals.maybe_get_global_value( "var_key_test_never_set" ) == nullptr );
+    CHECK( globals.get_global_value( "var_key_test_never_set" ).is_empty() );
+    globals.remove_global_value( "var_key_test_never_set" );
+    CHECK_FALSE( var_key::find( "var_key_test_never_set" ).has_value() );
+}
@@ -870,6 +870,40 @@ TEST_CASE( "power_network_rebuild_matches_grid", "[vehicle][power][grid]" )
     }
 }
 
+TEST_CASE( "power_network_topology_cache_follows_cable_changes", "[vehicle][power][grid]" )
+{
+    clear_map_without_vision();
+    clear_avatar();
+    map &here = get_map();
+    Character &player_character = get_player_character();
+    power_network_manager &pnm = g->power_networks();
+
+    const tripoint_bub_ms battery_pos( HALF_MAPSIZE_X + 2, HALF_MAPSIZE_Y + 2, 0 );
+    const tripoint_bub_ms lamp_pos( HALF_MAPSIZE_X + 4, HALF_MAPSIZE_Y + 2, 0 );
+
+    std::optional<item> battery_item( itype_test_storage_battery );
+    std::optional<item> lamp_item( itype_test_standing_lamp );
+    place_appliance( here, battery_pos, vpart_ap_test_storage_battery, player_character, battery_item );
+    place_appliance( here, lamp_pos, vpart_ap_test_standing_lamp, player_character, lamp_item );
+
+    vehicle &bat_veh = here.veh_at( battery_pos )->vehicle();
+    CHECK( bat_veh.search_connected_vehicles( here ).size() == 1 );
+    CHECK( pnm.find_cached_grid( &bat_veh ) != nullptr );
+
+    // Connecting the cable installs parts, which drops the cached walk
+    connect_power_cord( battery_pos, lamp_pos );
+    CHECK( pnm.find_cached_grid( &bat_veh ) == nullptr );
+    CHECK( bat_veh.search_connected_vehicles( here ).size() == 2 );
+    std::map<vehicle *, float> scratch;
+    CHECK( std::as_const( bat_veh ).connected_vehicles( here, scratch ).size() == 2 );
+    CHECK( scratch.empty() );
+
+    // Removing the other end of the cable does too
+    here.destroy_vehicle( &here.veh_at( lamp_pos )->vehicle() );
+    CHECK( pnm.find_cached_grid( &bat_veh ) == nullptr );
+    CHECK( bat_veh.search_connected_vehicles( here ).size() == 1 );
+}
+
 TEST_CASE( "power_network_serialization_round_trip", "[vehicle][power][grid]" )
 {
     // Load a hand-crafted network state from raw JSON
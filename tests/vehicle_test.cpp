@@ -21,6 +21,7 @@
 #include "itype.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "map_helpers_tests.h"
 #include "map_scale_constants.h"
 #include "player_activity.h"
 #include "player_helpers.h"
@@ -951,6 +952,65 @@ static void run_squish_test( const std::map<itype_id, double> &to_squish,
     }
 }
 
+TEST_CASE( "vehicle_collision_detection", "[vehicle]" )
+{
+    clear_map_without_vision();
+    clear_creatures();
+    map &here = get_map();
+    const tripoint_bub_ms test_point( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vehicle_prototype_car, test_point, 0_degrees, 0,
+                                         veh_spawn_status::UNDAMAGED );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    veh.velocity = 1000;
+
+    // The tile just in front of the car
+    tripoint_abs_ms front = *veh.get_points().begin();
+    for( const tripoint_abs_ms &p : veh.get_points() ) {
+        if( p.x() > front.x() ) {
+            front = p;
+        }
+    }
+    front += tripoint::east;
+    const tripoint_rel_ms forward = tripoint_rel_ms( 1, 0, 0 );
+
+    std::vector<veh_collision> colls;
+    CHECK_FALSE( veh.collision( here, colls, forward, true ) );
+    CHECK( colls.empty() );
+
+    SECTION( "creature in the way" ) {
+        spawn_test_monster( "mon_zombie", here.get_bub( front ) );
+        CHECK( veh.collision( here, colls, forward, true ) );
+        REQUIRE( colls.size() == 1 );
+        CHECK( colls[0].type == veh_coll_body );
+    }
+
+    SECTION( "driver aboard" ) {
+        Character &driver = get_player_character();
+        const vpart_reference controls = *veh.get_avail_parts( VPFLAG_CONTROLS ).begin();
+        here.board_vehicle( controls.pos_bub( here ), &driver );
+        REQUIRE( driver.in_vehicle );
+        veh.part_project_points( forward );
+        // The driver moves along with the car and is not in its way.
+        CHECK( veh.projected_area_clear( here ) );
+        CHECK_FALSE( veh.collision( here, colls, forward, true ) );
+        CHECK( colls.empty() );
+
+        spawn_test_monster( "mon_zombie", here.get_bub( front ) );
+        CHECK( veh.collision( here, colls, forward, true ) );
+        REQUIRE( colls.size() == 1 );
+        CHECK( colls[0].type == veh_coll_body );
+    }
+
+    SECTION( "vehicle in the way" ) {
+        REQUIRE( here.add_vehicle( vehicle_prototype_unicycle_normal_wheel, here.get_bub( front ),
+                                   0_degrees, 0, veh_spawn_status::UNDAMAGED ) != nullptr );
+        CHECK( veh.collision( here, colls, forward, true ) );
+        REQUIRE( colls.size() == 1 );
+        CHECK( colls[0].type == veh_coll_veh );
+    }
+}
+
 TEST_CASE( "vehicle_wheels_damaged_by_running_over_items", "[vehicle]" )
 {
     clear_map_without_vision();
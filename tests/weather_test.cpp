@@ -10,8 +10,10 @@
 #include "cata_catch.h"
 #include "cata_scope_helpers.h"
 #include "coordinates.h"
+#include "map_scale_constants.h"
 #include "options_helpers.h"
 #include "pimpl.h"
+#include "point.h"
 #include "type_id.h"
 #include "units.h"
 #include "weather.h"
@@ -191,6 +193,30 @@ TEST_CASE( "eternal_season", "[weather]" )
     }
 }
 
+TEST_CASE( "area_weather_conditions_are_shared", "[weather]" )
+{
+    weather_manager &weather = get_weather();
+    weather.clear_temp_cache();
+    const tripoint_abs_omt omt( 10, 10, 0 );
+    const time_point start = calendar::start_of_cataclysm + 1_days;
+    const time_point end = start + 2_hours;
+
+    const weather_sum &area = weather.get_area_conditions( start, end, omt );
+    const weather_sum center = sum_conditions( start, end,
+                               project_to<coords::ms>( omt ) + point( SEEX, SEEY ) );
+    CHECK( area.rain_amount == center.rain_amount );
+    CHECK( area.radiant_exposure == Approx( center.radiant_exposure ) );
+
+    // Asking again for the same area and interval doesn't sum the weather again
+    CHECK( &weather.get_area_conditions( start, end, omt ) == &area );
+    CHECK( weather.weather_sum_cache.size() == 1 );
+    weather.get_area_conditions( start - 1_hours, end, omt );
+    CHECK( weather.weather_sum_cache.size() == 2 );
+
+    weather.clear_temp_cache();
+    CHECK( weather.weather_sum_cache.empty() );
+}
+
 TEST_CASE( "local_wind_chill_calculation", "[weather][wind_chill]" )
 {
     // `get_local_windchill` returns degrees F offset from current temperature,